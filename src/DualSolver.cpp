@@ -18,6 +18,12 @@
 #include "Problem.h"
 #include "ObjectiveFunction.h"
 
+#include "MIPSolver/IMIPSolver.h"
+
+#include <algorithm>
+
+#include <boost/functional/hash/hash.hpp>
+
 namespace SHOT
 {
 
@@ -180,10 +186,14 @@ void DualSolver::addGeneratedHyperplane(const Hyperplane& hyperplane)
         env->output->outputDebug("Solution is no longer global");
     }
 
-    genHyperplane.pointHash = Utilities::calculateHash(hyperplane.generatedPoint);
+    genHyperplane.pointHash = calculatePointHash(hyperplane.generatedPoint);
 
     generatedHyperplanes.push_back(genHyperplane);
 
+    std::size_t hash = genHyperplane.pointHash;
+    boost::hash_combine(hash, genHyperplane.sourceConstraintIndex);
+    generatedHyperplanePoints.insert(hash);
+
     auto currentIteration = env->results->getCurrentIteration();
     currentIteration->numHyperplanesAdded++;
     currentIteration->totNumHyperplanes++;
@@ -192,16 +202,190 @@ void DualSolver::addGeneratedHyperplane(const Hyperplane& hyperplane)
     env->output->outputTrace("     Hyperplane generated from: " + source);
 }
 
-bool DualSolver::hasHyperplaneBeenAdded(size_t hash, int constraintIndex)
+bool DualSolver::hasHyperplaneBeenAdded(const VectorDouble& point, int constraintIndex)
+{
+    std::size_t hash = calculatePointHash(point);
+    boost::hash_combine(hash, constraintIndex);
+
+    if(generatedHyperplanePoints.count(hash) == 0)
+        return (false);
+
+    env->solutionStatistics.numberOfDuplicateHyperplanesRejected++;
+    return (true);
+}
+
+bool DualSolver::isHyperplaneNearDuplicate(const LinearConstraintRows& rows, size_t row)
 {
-    return (false);
-    for(auto& H : generatedHyperplanes)
+    double tolerance = env->settings->getSetting<double>("HyperplaneCuts.NearDuplicateTolerance", "Dual");
+
+    if(tolerance <= 0.0)
+        return (false);
+
+    double constant = rows.constants[row];
+    double largestCoefficient = std::abs(constant);
+
+    for(int j = rows.rowStarts[row]; j < rows.rowStarts[row + 1]; j++)
+        largestCoefficient = std::max(largestCoefficient, std::abs(rows.coefficients[j]));
+
+    if(largestCoefficient == 0.0)
+        return (false);
+
+    // The hyperplanes are scaled so that the largest coefficient is one, and the coefficients are then rounded to
+    // the tolerance
+    std::size_t hash = 0;
+    boost::hash_combine(hash, std::round(constant / largestCoefficient / tolerance));
+
+    for(int j = rows.rowStarts[row]; j < rows.rowStarts[row + 1]; j++)
     {
-        if(H.sourceConstraintIndex == constraintIndex && H.pointHash == hash)
-            return (true);
+        double coefficient = std::round(rows.coefficients[j] / largestCoefficient / tolerance);
+
+        if(coefficient != 0.0)
+        {
+            boost::hash_combine(hash, rows.columnIndices[j]);
+            boost::hash_combine(hash, coefficient);
+        }
     }
 
-    return (false);
+    if(hyperplaneCoefficients.insert(hash).second)
+        return (false);
+
+    env->solutionStatistics.numberOfNearDuplicateHyperplanesRejected++;
+    return (true);
+}
+
+void DualSolver::clearHyperplaneCoefficients() { hyperplaneCoefficients.clear(); }
+
+void DualSolver::addCutToPool(
+    const LinearConstraintRows& rows, size_t row, int constraintIndex, int sourceConstraintIndex)
+{
+    if(env->settings->getSetting<int>("HyperplaneCuts.CutPool.MaxInactiveIterations", "Dual") <= 0)
+        return;
+
+    CutPoolEntry cut;
+
+    for(int j = rows.rowStarts[row]; j < rows.rowStarts[row + 1]; j++)
+        cut.elements.emplace(rows.columnIndices[j], rows.coefficients[j]);
+
+    cut.constant = rows.constants[row];
+    cut.constraintIndex = constraintIndex;
+    cut.sourceConstraintIndex = sourceConstraintIndex;
+
+    cutPool.push_back(std::move(cut));
+}
+
+void DualSolver::updateCutPool(const VectorDouble& point)
+{
+    int maxInactiveIterations = env->settings->getSetting<int>("HyperplaneCuts.CutPool.MaxInactiveIterations", "Dual");
+
+    if(maxInactiveIterations <= 0 || cutPool.size() == 0)
+        return;
+
+    double tolerance = env->settings->getSetting<double>("HyperplaneCuts.CutPool.InactiveTolerance", "Dual");
+    auto currIter = env->results->getCurrentIteration();
+
+    int numberOfAddedCuts = 0;
+
+    for(size_t k = 0; k < cutPool.size(); k++)
+    {
+        auto& cut = cutPool[k];
+        double value = cut.constant;
+        bool isValueDefined = true;
+
+        for(auto& E : cut.elements)
+        {
+            // The auxiliary variables of the dual problem are not in the solution point
+            if(E.first >= (int)point.size())
+            {
+                isValueDefined = false;
+                break;
+            }
+
+            value += E.second * point[E.first];
+        }
+
+        if(!isValueDefined)
+            continue;
+
+        cut.slack = -value;
+
+        if(cut.constraintIndex >= 0)
+        {
+            if(cut.slack > tolerance)
+                cut.numberOfInactiveIterations++;
+            else
+                cut.numberOfInactiveIterations = 0;
+        }
+        else if(cut.slack < -tolerance)
+        {
+            // A removed cut violated by the solution is added back, which is cheaper than generating a new one
+            cut.constraintIndex
+                = MIPSolver->addLinearConstraint(cut.elements, cut.constant, "H_POOL_" + std::to_string(k));
+
+            if(cut.constraintIndex >= 0)
+            {
+                cut.numberOfInactiveIterations = 0;
+                numberOfAddedCuts++;
+            }
+        }
+    }
+
+    if(numberOfAddedCuts > 0)
+    {
+        env->solutionStatistics.numberOfHyperplanesAddedFromCutPool += numberOfAddedCuts;
+        currIter->totNumHyperplanes += numberOfAddedCuts;
+
+        env->output->outputDebug(
+            fmt::format("        Added {} violated cuts back from the cut pool.", numberOfAddedCuts));
+    }
+
+    if(currIter->iterationNumber % env->settings->getSetting<int>("HyperplaneCuts.CutPool.RemovalFrequency", "Dual")
+        != 0)
+        return;
+
+    VectorInteger removedIndices;
+
+    for(auto& cut : cutPool)
+    {
+        if(cut.constraintIndex >= 0 && cut.numberOfInactiveIterations >= maxInactiveIterations)
+            removedIndices.push_back(cut.constraintIndex);
+    }
+
+    if(removedIndices.size() == 0 || !MIPSolver->removeLinearConstraints(removedIndices))
+        return;
+
+    std::sort(removedIndices.begin(), removedIndices.end());
+
+    for(auto& cut : cutPool)
+    {
+        if(cut.constraintIndex < 0)
+            continue;
+
+        auto position = std::lower_bound(removedIndices.begin(), removedIndices.end(), cut.constraintIndex);
+
+        if(position != removedIndices.end() && *position == cut.constraintIndex)
+        {
+            cut.constraintIndex = -1;
+            cut.numberOfTimesRemoved++;
+        }
+        else
+        {
+            // The cuts after the removed ones are moved forward
+            cut.constraintIndex -= static_cast<int>(position - removedIndices.begin());
+        }
+    }
+
+    int numberOfRemovedCuts = static_cast<int>(removedIndices.size());
+    env->solutionStatistics.numberOfHyperplanesRemovedToCutPool += numberOfRemovedCuts;
+    currIter->totNumHyperplanes -= numberOfRemovedCuts;
+
+    env->output->outputDebug(fmt::format("        Removed {} cuts inactive in {} dual solutions from the dual problem.",
+        numberOfRemovedCuts, maxInactiveIterations));
+}
+
+std::size_t DualSolver::calculatePointHash(const VectorDouble& point)
+{
+    return (Utilities::calculateHash(
+        point, env->settings->getSetting<double>("HyperplaneCuts.DuplicatePointTolerance", "Dual")));
 }
 
 } // namespace SHOT
\ No newline at end of file
@@ -12,8 +12,27 @@
 #include "Environment.h"
 #include "Structs.h"
 
+#include <map>
+#include <unordered_set>
+
 namespace SHOT
 {
+
+// A hyperplane cut sum(elements) + constant <= 0 that has been added to the dual problem
+struct CutPoolEntry
+{
+    std::map<int, double> elements;
+    double constant = 0.0;
+    int sourceConstraintIndex = -1;
+
+    // The index of the cut in the dual problem, or -1 if it has been removed and is only kept in the pool
+    int constraintIndex = -1;
+
+    double slack = 0.0; // In the last dual solution
+    int numberOfInactiveIterations = 0; // The number of consecutive dual solutions where the slack was positive
+    int numberOfTimesRemoved = 0;
+};
+
 class DualSolver
 {
 public:
@@ -28,7 +47,28 @@ public:
     void checkDualSolutionCandidates();
 
     void addGeneratedHyperplane(const Hyperplane& hyperplane);
-    bool hasHyperplaneBeenAdded(size_t hash, int constraintIndex);
+
+    // Whether a hyperplane for the constraint has been generated in the point, where the point is compared within
+    // the tolerance HyperplaneCuts.DuplicatePointTolerance
+    bool hasHyperplaneBeenAdded(const VectorDouble& point, int constraintIndex);
+
+    // Whether a hyperplane with the same normalized coefficients (within HyperplaneCuts.NearDuplicateTolerance) has
+    // been added to the dual problem. If not, the coefficients are stored for the following checks.
+    bool isHyperplaneNearDuplicate(const LinearConstraintRows& rows, size_t row);
+
+    // Called when the dual problem is recreated and does not contain the added hyperplanes anymore
+    void clearHyperplaneCoefficients();
+
+    // Adds the hyperplane cut in the given row, that has been added to the dual problem with the given constraint
+    // index, to the cut pool. Does nothing if the cut pool is not used.
+    void addCutToPool(const LinearConstraintRows& rows, size_t row, int constraintIndex, int sourceConstraintIndex);
+
+    // Updates the slacks of the cuts in the pool in the dual solution point. Removed cuts that are violated in the
+    // point are added back to the dual problem, and cuts that have been inactive for
+    // HyperplaneCuts.CutPool.MaxInactiveIterations dual solutions are periodically removed from it.
+    void updateCutPool(const VectorDouble& point);
+
+    std::vector<CutPoolEntry> cutPool;
 
     std::vector<GeneratedHyperplane> generatedHyperplanes;
 
@@ -43,6 +83,14 @@ public:
     bool isSingleTree = false;
 
 private:
+    std::size_t calculatePointHash(const VectorDouble& point);
+
+    // The combined hashes of the constraint indices and generation points of the generated hyperplanes
+    std::unordered_set<std::size_t> generatedHyperplanePoints;
+
+    // The hashes of the normalized coefficients of the hyperplanes in the dual problem
+    std::unordered_set<std::size_t> hyperplaneCoefficients;
+
     EnvironmentPtr env;
 };
 
@@ -295,7 +295,8 @@ enum class ES_RootsearchMethod
 {
     BoostTOMS748,
     BoostBisection,
-    Bisection
+    Bisection,
+    SafeguardedNewton
 };
 
 enum class ES_MIPSolver
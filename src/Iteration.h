@@ -49,6 +49,11 @@ public:
     int numberOfExploredNodes = 0;
     int numberOfOpenNodes = 0;
 
+    int numberOfRootsearches = 0;
+    int numberOfWarmStartedRootsearches = 0;
+    int numberOfRootsearchFunctionEvaluations = 0;
+    int numberOfRootsearchFunctionEvaluationsSaved = 0;
+
     double boundaryDistance;
 
     bool isMIP();
@@ -73,12 +73,20 @@ public:
     virtual void writeProblemToFile(std::string filename) = 0;
     virtual void writePresolvedToFile(std::string filename) = 0;
 
-    virtual std::vector<SolutionPoint> getAllVariableSolutions() = 0;
+    virtual const std::vector<SolutionPoint>& getAllVariableSolutions() = 0;
     virtual int addLinearConstraint(std::map<int, double>& elements, double constant, std::string name) = 0;
     virtual int addLinearConstraint(
         const std::map<int, double>& elements, double constant, std::string name, bool isGreaterThan)
         = 0;
 
+    // Adds the rows as less than constraints with one call to the solver. The rows get consecutive indices, the index
+    // of the first one is returned, or -1 if the rows could not be added.
+    virtual int addLinearConstraints(const LinearConstraintRows& rows) = 0;
+
+    // Removes the linear constraints with the given indices. The indices of the remaining constraints are updated as
+    // if the removed ones had never been added. Returns false if the solver does not support removing constraints.
+    virtual bool removeLinearConstraints(const VectorInteger& constraintIndices) = 0;
+
     virtual void setTimeLimit(double seconds) = 0;
 
     virtual void setCutOff(double cutOff) = 0;
@@ -101,6 +109,9 @@ public:
     virtual std::pair<VectorDouble, VectorDouble> presolveAndGetNewBounds() = 0;
 
     virtual bool createHyperplane(Hyperplane hyperplane) = 0;
+
+    // Adds the hyperplanes to the dual problem together, returns for each hyperplane whether it was added
+    virtual std::vector<bool> createHyperplanes(const std::vector<Hyperplane>& hyperplanes) = 0;
     virtual bool createIntegerCut(VectorInteger& binaryIndexesOnes, VectorInteger& binaryIndexesZeroes) = 0;
     virtual bool createInteriorHyperplane(Hyperplane hyperplane) = 0;
 
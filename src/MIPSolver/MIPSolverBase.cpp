@@ -17,6 +17,8 @@
 #include "../Settings.h"
 #include "../Utilities.h"
 
+#include <algorithm>
+
 namespace SHOT
 {
 
@@ -65,19 +67,20 @@ void MIPSolverBase::executeRelaxationStrategy()
     MIPSolverBase::relaxationStrategy->executeStrategy();
 }
 
-std::vector<SolutionPoint> MIPSolverBase::getAllVariableSolutions()
+const std::vector<SolutionPoint>& MIPSolverBase::getAllVariableSolutions()
 {
     if(cachedSolutionHasChanged == false)
         return (lastSolutions);
 
     int numSol = getNumberOfSolutions();
 
-    std::vector<SolutionPoint> lastSolutions(numSol);
+    lastSolutions.clear();
+    lastSolutions.reserve(numSol);
+
+    std::vector<VectorDouble> points(numSol);
 
     for(int i = 0; i < numSol; i++)
     {
-        SolutionPoint tmpSolPt;
-
         auto tmpPt = getVariableSolution(i);
 
         while((int)tmpPt.size() > env->reformulatedProblem->properties.numberOfVariables)
@@ -85,23 +88,51 @@ std::vector<SolutionPoint> MIPSolverBase::getAllVariableSolutions()
             tmpPt.pop_back();
         }
 
-        tmpSolPt.point = tmpPt;
+        points.at(i) = tmpPt;
+    }
+
+    // The values of the nonlinear constraints are calculated for all solutions in the pool at once and stored sorted
+    // in the solution points, so that the tasks using the solutions do not need to calculate them again. Only values
+    // that are NaN are left out.
+    std::vector<NumericConstraintValues> constraintValues;
+
+    if(numSol > 0 && env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        constraintValues = env->reformulatedProblem->getFractionOfDeviatingNonlinearConstraints(
+            points, std::numeric_limits<double>::lowest(), 1.0);
+    }
+
+    for(int i = 0; i < numSol; i++)
+    {
+        SolutionPoint tmpSolPt;
+
+        tmpSolPt.point = std::move(points.at(i));
 
         tmpSolPt.objectiveValue = getObjectiveValue(i);
         tmpSolPt.iterFound = env->results->getCurrentIteration()->iterationNumber;
 
         if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
         {
-            auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
-                tmpPt, env->reformulatedProblem->nonlinearConstraints);
-            tmpSolPt.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
+            auto values = std::make_shared<const NumericConstraintValues>(std::move(constraintValues.at(i)));
+
+            if(values->size() > 0)
+            {
+                tmpSolPt.maxDeviation = PairIndexValue(values->at(0).constraint->index, values->at(0).normalizedValue);
+            }
+            else
+            {
+                tmpSolPt.maxDeviation = PairIndexValue(env->reformulatedProblem->nonlinearConstraints.at(0)->index,
+                    std::numeric_limits<double>::quiet_NaN());
+            }
+
+            tmpSolPt.nonlinearConstraintValues = values;
         }
         else
         {
             tmpSolPt.maxDeviation = PairIndexValue(-1, 0.0);
         }
 
-        lastSolutions.at(i) = tmpSolPt;
+        lastSolutions.push_back(std::move(tmpSolPt));
     }
 
     cachedSolutionHasChanged = false;
@@ -109,57 +140,115 @@ std::vector<SolutionPoint> MIPSolverBase::getAllVariableSolutions()
     return (lastSolutions);
 }
 
-bool MIPSolverBase::createHyperplane(Hyperplane hyperplane)
+bool MIPSolverBase::createHyperplane(Hyperplane hyperplane) { return (createHyperplanes({ hyperplane }).at(0)); }
+
+std::vector<bool> MIPSolverBase::createHyperplanes(const std::vector<Hyperplane>& hyperplanes)
 {
-    auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
+    std::vector<bool> isAdded(hyperplanes.size(), false);
 
-    auto optional = createHyperplaneTerms(hyperplane);
+    LinearConstraintRows rows;
+    std::vector<size_t> rowHyperplanes; // The index of the hyperplane of each row
 
-    if(!optional)
+    for(size_t i = 0; i < hyperplanes.size(); i++)
     {
-        return (false);
-    }
+        auto& hyperplane = hyperplanes[i];
 
-    auto tmpPair = optional.value();
+        std::string identifier = getConstraintIdentifier(hyperplane.source);
 
-    for(auto& E : tmpPair.first)
-    {
-        if(E.second != E.second || std::isinf(E.second)) // Check for NaN or inf
+        if(hyperplane.sourceConstraint != nullptr)
+            identifier = identifier + "_" + hyperplane.sourceConstraint->name;
+
+        identifier += "_" + std::to_string(constraintCounter);
+
+        if(!appendHyperplaneRow(hyperplane, identifier, rows))
+            continue;
+
+        size_t row = rows.size() - 1;
+        bool isRowValid = true;
+
+        for(int j = rows.rowStarts[row]; j < rows.rowStarts[row + 1]; j++)
         {
-            if(hyperplane.isObjectiveHyperplane)
-                env->output->outputError("        Warning: hyperplane for objective function not generated, NaN or inf "
-                                         "found in linear terms for "
-                    + env->problem->getVariable(E.first)->name + " = "
-                    + std::to_string(hyperplane.generatedPoint.at(E.first)));
-            else
-                env->output->outputError("        Warning: hyperplane for constraint "
-                    + hyperplane.sourceConstraint->name + " not generated,  NaN or inf found in linear terms for "
-                    + env->problem->getVariable(E.first)->name + " = "
-                    + std::to_string(hyperplane.generatedPoint.at(E.first)));
+            double coefficient = rows.coefficients[j];
+
+            if(coefficient != coefficient || std::isinf(coefficient)) // Check for NaN or inf
+            {
+                int variableIndex = rows.columnIndices[j];
+
+                if(hyperplane.isObjectiveHyperplane)
+                    env->output->outputError("        Warning: hyperplane for objective function not generated, NaN "
+                                             "or inf found in linear terms for "
+                        + env->problem->getVariable(variableIndex)->name + " = "
+                        + std::to_string(hyperplane.generatedPoint.at(variableIndex)));
+                else
+                    env->output->outputError("        Warning: hyperplane for constraint "
+                        + hyperplane.sourceConstraint->name + " not generated,  NaN or inf found in linear terms for "
+                        + env->problem->getVariable(variableIndex)->name + " = "
+                        + std::to_string(hyperplane.generatedPoint.at(variableIndex)));
+
+                isRowValid = false;
+                break;
+            }
+        }
 
-            return (false);
+        if(isRowValid && env->dualSolver->isHyperplaneNearDuplicate(rows, row))
+        {
+            env->output->outputDebug("        Hyperplane not added since it is a near duplicate of an added one.");
+            isRowValid = false;
+        }
+
+        if(!isRowValid)
+        {
+            rows.removeLastRow();
+            continue;
         }
+
+        rowHyperplanes.push_back(i);
+        constraintCounter++;
     }
 
-    std::string constraintName;
+    if(rows.size() == 0)
+        return (isAdded);
 
-    std::string identifier = getConstraintIdentifier(hyperplane.source);
+    int firstConstraintIndex = addLinearConstraints(rows);
 
-    if(hyperplane.sourceConstraint != nullptr)
-        identifier = identifier + "_" + hyperplane.sourceConstraint->name;
+    if(firstConstraintIndex < 0)
+        return (isAdded);
 
-    identifier += "_" + std::to_string(constraintCounter);
-    constraintCounter++;
+    for(size_t row = 0; row < rows.size(); row++)
+    {
+        auto& hyperplane = hyperplanes[rowHyperplanes[row]];
+        isAdded[rowHyperplanes[row]] = true;
 
-    if(addLinearConstraint(tmpPair.first, tmpPair.second, identifier) < 0)
-        return (false);
+        // The objective cuts are never removed
+        if(!hyperplane.isObjectiveHyperplane)
+            env->dualSolver->addCutToPool(
+                rows, row, firstConstraintIndex + static_cast<int>(row), hyperplane.sourceConstraintIndex);
+    }
 
-    return (true);
+    return (isAdded);
 }
 
 std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyperplaneTerms(Hyperplane hyperplane)
 {
+    std::optional<std::pair<std::map<int, double>, double>> optional;
+
+    LinearConstraintRows rows;
+
+    if(!appendHyperplaneRow(hyperplane, "", rows))
+        return (optional);
+
     std::map<int, double> elements;
+
+    for(int j = rows.rowStarts[0]; j < rows.rowStarts[1]; j++)
+        elements.emplace_hint(elements.end(), rows.columnIndices[j], rows.coefficients[j]);
+
+    optional = std::make_pair(std::move(elements), rows.constants[0]);
+
+    return (optional);
+}
+
+bool MIPSolverBase::appendHyperplaneRow(Hyperplane hyperplane, const std::string& name, LinearConstraintRows& rows)
+{
     double constant = 0.0;
     SparseVariableVector gradient;
     double signFactor = 1.0; // Will be -1.0 for greater than constraints
@@ -181,8 +270,6 @@ std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyp
                       ->calculateGradient(hyperplane.generatedPoint, true);
         }
 
-        elements.emplace(dualAuxiliaryObjectiveVariableIndex, -1.0);
-
         env->output->outputTrace("     HP point generated for objective function with "
             + std::to_string(gradient.size()) + " elements and constant " + std::to_string(constant));
     }
@@ -201,8 +288,16 @@ std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyp
             constant = maxDev.normalizedRHSValue;
         }
 
-        gradient = std::dynamic_pointer_cast<NonlinearConstraint>(hyperplane.sourceConstraint)
-                       ->calculateGradient(hyperplane.generatedPoint, true);
+        if(hyperplane.gradient.empty())
+        {
+            gradient = std::dynamic_pointer_cast<NonlinearConstraint>(hyperplane.sourceConstraint)
+                           ->calculateGradient(hyperplane.generatedPoint, true);
+        }
+        else
+        {
+            // The gradient has been calculated together with those of other hyperplanes in the same point
+            gradient = std::move(hyperplane.gradient);
+        }
 
         auto nonzeroes
             = std::count_if(gradient.begin(), gradient.end(), [](auto element) { return (element.second != 0.0); });
@@ -228,18 +323,14 @@ std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyp
             + " elements.");
     }
 
+    // The coefficients are written directly to the rows
     for(auto const& G : gradient)
     {
         double coefficient = signFactor * G.second;
         int variableIndex = G.first->index;
 
-        auto element = elements.emplace(variableIndex, coefficient);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += coefficient;
-        }
+        rows.columnIndices.push_back(variableIndex);
+        rows.coefficients.push_back(coefficient);
 
         constant += signFactor * (-G.second) * hyperplane.generatedPoint.at(variableIndex);
 
@@ -247,14 +338,20 @@ std::optional<std::pair<std::map<int, double>, double>> MIPSolverBase::createHyp
             + std::to_string(hyperplane.generatedPoint.at(variableIndex)) + ": " + std::to_string(coefficient));
     }
 
-    std::optional<std::pair<std::map<int, double>, double>> optional;
+    if(hyperplane.isObjectiveHyperplane)
+    {
+        rows.columnIndices.push_back(dualAuxiliaryObjectiveVariableIndex);
+        rows.coefficients.push_back(-1.0);
+    }
 
-    if(elements.size() > 0)
-        optional = std::make_pair(elements, constant);
+    if(static_cast<int>(rows.columnIndices.size()) == rows.rowStarts.back())
+        return (false);
 
-    elements.clear();
+    rows.rowStarts.push_back(static_cast<int>(rows.columnIndices.size()));
+    rows.constants.push_back(constant);
+    rows.names.push_back(name);
 
-    return (optional);
+    return (true);
 }
 
 bool MIPSolverBase::createInteriorHyperplane([[maybe_unused]] Hyperplane hyperplane)
@@ -329,6 +426,25 @@ bool MIPSolverBase::createInteriorHyperplane([[maybe_unused]] Hyperplane hyperpl
     return (false);
 }
 
+void MIPSolverBase::updateConstraintIndicesAfterRemoval(const VectorInteger& removedIndices)
+{
+    VectorInteger sortedIndices = removedIndices;
+    std::sort(sortedIndices.begin(), sortedIndices.end());
+
+    // Each index is reduced by the number of removed constraints before it
+    auto getNewIndex = [&sortedIndices](int index) {
+        return (index
+            - static_cast<int>(
+                std::lower_bound(sortedIndices.begin(), sortedIndices.end(), index) - sortedIndices.begin()));
+    };
+
+    if(cutOffConstraintDefined)
+        cutOffConstraintIndex = getNewIndex(cutOffConstraintIndex);
+
+    for(auto& I : integerCuts)
+        I = getNewIndex(I);
+}
+
 void MIPSolverBase::presolveAndUpdateBounds()
 {
     auto newBounds = this->presolveAndGetNewBounds();
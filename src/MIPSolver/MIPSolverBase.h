@@ -55,10 +55,15 @@ public:
 
     virtual bool createHyperplane(Hyperplane hyperplane);
 
+    virtual std::vector<bool> createHyperplanes(const std::vector<Hyperplane>& hyperplanes);
+
     virtual bool createInteriorHyperplane(Hyperplane hyperplane);
 
     std::optional<std::pair<std::map<int, double>, double>> createHyperplaneTerms(Hyperplane hyperplane);
 
+    // Appends the linear terms of the hyperplane as a row named name, returns false if no row could be generated
+    bool appendHyperplaneRow(Hyperplane hyperplane, const std::string& name, LinearConstraintRows& rows);
+
     virtual void setCutOffAsConstraint(double cutOff) = 0;
 
     virtual E_DualProblemClass getProblemClass();
@@ -66,7 +71,7 @@ public:
 
     virtual void executeRelaxationStrategy();
 
-    virtual std::vector<SolutionPoint> getAllVariableSolutions();
+    virtual const std::vector<SolutionPoint>& getAllVariableSolutions();
     virtual int getNumberOfSolutions() = 0;
     virtual VectorDouble getVariableSolution(int i) = 0;
     virtual double getObjectiveValue(int i) = 0;
@@ -87,6 +92,12 @@ public:
         const std::map<int, double>& elements, double constant, std::string name, bool isGreaterThan)
         = 0;
 
+    virtual int addLinearConstraints(const LinearConstraintRows& rows) = 0;
+
+    // Updates the indices of the cutoff constraint and integer cuts after the constraints with the given indices have
+    // been removed from the problem
+    void updateConstraintIndicesAfterRemoval(const VectorInteger& removedIndices);
+
     virtual void activateDiscreteVariables(bool activate) = 0;
 
     virtual int getNumberOfExploredNodes() = 0;
@@ -25,6 +25,7 @@
 #include "CoinModel.hpp"
 #include "CoinPragma.hpp"
 #include "CbcModel.hpp"
+#include "CoinWarmStartBasis.hpp"
 #include "OsiClpSolverInterface.hpp"
 
 namespace SHOT
@@ -55,6 +56,7 @@ bool MIPSolverCbc::initializeProblem()
 
     osiInterface = std::make_unique<OsiClpSolverInterface>();
     coinModel = std::make_unique<CoinModel>();
+    rootBasis.reset();
 
     cachedSolutionHasChanged = true;
     isVariablesFixed = false;
@@ -306,6 +308,61 @@ int MIPSolverCbc::addLinearConstraint(
     return (osiInterface->getNumRows() - 1);
 }
 
+int MIPSolverCbc::addLinearConstraints(const LinearConstraintRows& rows)
+{
+    int firstIndex = osiInterface->getNumRows();
+
+    if(rows.size() == 0)
+        return (firstIndex);
+
+    try
+    {
+        std::vector<CoinBigIndex> rowStarts(rows.rowStarts.begin(), rows.rowStarts.end());
+        VectorDouble lowerBounds(rows.size(), -osiInterface->getInfinity());
+        VectorDouble upperBounds(rows.size());
+
+        for(size_t i = 0; i < rows.size(); i++)
+            upperBounds[i] = -rows.constants[i];
+
+        osiInterface->addRows(static_cast<int>(rows.size()), rowStarts.data(), rows.columnIndices.data(),
+            rows.coefficients.data(), lowerBounds.data(), upperBounds.data());
+
+        for(size_t i = 0; i < rows.size(); i++)
+            osiInterface->setRowName(firstIndex + static_cast<int>(i), rows.names[i]);
+    }
+    catch(CoinError& e)
+    {
+        env->output->outputError("Error when adding linear constraints in Cbc: ", e.message());
+        return (-1);
+    }
+
+    return (firstIndex);
+}
+
+bool MIPSolverCbc::removeLinearConstraints(const VectorInteger& constraintIndices)
+{
+    if(constraintIndices.size() == 0)
+        return (true);
+
+    try
+    {
+        osiInterface->deleteRows(static_cast<int>(constraintIndices.size()), constraintIndices.data());
+
+        if(rootBasis)
+            rootBasis->deleteRows(static_cast<int>(constraintIndices.size()), constraintIndices.data());
+    }
+    catch(CoinError& e)
+    {
+        env->output->outputError("Error when removing linear constraints in Cbc: ", e.message());
+        return (false);
+    }
+
+    updateConstraintIndicesAfterRemoval(constraintIndices);
+    modelUpdated = true;
+
+    return (true);
+}
+
 void MIPSolverCbc::activateDiscreteVariables(bool activate)
 {
     if(activate)
@@ -389,6 +446,9 @@ E_ProblemSolutionStatus MIPSolverCbc::solveProblem()
 
     try
     {
+        if(env->settings->getSetting<bool>("Cbc.PersistentModel", "Subsolver"))
+            warmStartRootRelaxation();
+
         cbcModel = std::make_unique<CbcModel>(*osiInterface);
 
         initializeSolverSettings();
@@ -513,6 +573,38 @@ E_ProblemSolutionStatus MIPSolverCbc::solveProblem()
     return (MIPSolutionStatus);
 }
 
+void MIPSolverCbc::warmStartRootRelaxation()
+{
+    try
+    {
+        if(rootBasis)
+        {
+            // The rows added since the previous iteration are basic in the extended basis
+            rootBasis->resize(osiInterface->getNumRows(), osiInterface->getNumCols());
+            osiInterface->setWarmStart(rootBasis.get());
+            osiInterface->resolve();
+        }
+        else
+        {
+            osiInterface->initialSolve();
+        }
+
+        env->output->outputDebug(fmt::format("        LP relaxation solved in {} simplex iterations before Cbc.",
+            osiInterface->getIterationCount()));
+
+        // The basis is kept only if it is optimal, otherwise the next iteration starts from scratch
+        if(osiInterface->isProvenOptimal())
+            rootBasis.reset(dynamic_cast<CoinWarmStartBasis*>(osiInterface->getWarmStart()));
+        else
+            rootBasis.reset();
+    }
+    catch(CoinError& e)
+    {
+        env->output->outputError("Error when warm starting the LP relaxation in Cbc: ", e.message());
+        rootBasis.reset();
+    }
+}
+
 bool MIPSolverCbc::repairInfeasibility() { return false; }
 
 int MIPSolverCbc::increaseSolutionLimit(int increment)
@@ -18,10 +18,11 @@
 class OsiClpSolverInterface;
 class CbcModel;
 class CoinModel;
+class CoinWarmStartBasis;
 
 namespace SHOT
 {
-class MIPSolverCbc : public IMIPSolver, MIPSolverBase
+class MIPSolverCbc : public IMIPSolver, public MIPSolverBase
 {
 public:
     MIPSolverCbc(EnvironmentPtr envPtr);
@@ -57,8 +58,17 @@ public:
     int addLinearConstraint(
         const std::map<int, double>& elements, double constant, std::string name, bool isGreaterThan) override;
 
+    int addLinearConstraints(const LinearConstraintRows& rows) override;
+
+    bool removeLinearConstraints(const VectorInteger& constraintIndices) override;
+
     bool createHyperplane(Hyperplane hyperplane) override { return (MIPSolverBase::createHyperplane(hyperplane)); }
 
+    std::vector<bool> createHyperplanes(const std::vector<Hyperplane>& hyperplanes) override
+    {
+        return (MIPSolverBase::createHyperplanes(hyperplanes));
+    }
+
     bool createIntegerCut(VectorInteger& binaryIndexesOnes, VectorInteger& binaryIndexesZeroes) override;
 
     bool createInteriorHyperplane(Hyperplane hyperplane) override
@@ -103,7 +113,10 @@ public:
     E_ProblemSolutionStatus getSolutionStatus() override;
     int getNumberOfSolutions() override;
     VectorDouble getVariableSolution(int solIdx) override;
-    std::vector<SolutionPoint> getAllVariableSolutions() override { return (MIPSolverBase::getAllVariableSolutions()); }
+    const std::vector<SolutionPoint>& getAllVariableSolutions() override
+    {
+        return (MIPSolverBase::getAllVariableSolutions());
+    }
     double getDualObjectiveValue() override;
     double getObjectiveValue(int solIdx) override;
     double getObjectiveValue() override { return (MIPSolverBase::getObjectiveValue()); }
@@ -145,11 +158,18 @@ public:
         return (MIPSolverBase::getConstraintIdentifier(source));
     };
 
-private:
+protected:
+    // Solves the LP relaxation of the dual problem starting from the optimal basis of the previous iteration, so that
+    // the model passed to Cbc starts from an optimal root basis
+    void warmStartRootRelaxation();
+
     std::unique_ptr<OsiClpSolverInterface> osiInterface;
     std::unique_ptr<CbcModel> cbcModel;
     std::unique_ptr<CoinModel> coinModel;
 
+    // The optimal basis of the LP relaxation in the previous iteration, if Cbc.PersistentModel is used
+    std::unique_ptr<CoinWarmStartBasis> rootBasis;
+
     CoinPackedVector objectiveLinearExpression;
 
     long int solLimit;
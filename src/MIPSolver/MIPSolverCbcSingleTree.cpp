@@ -0,0 +1,503 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "MIPSolverCbcSingleTree.h"
+
+#include "../DualSolver.h"
+#include "../Iteration.h"
+#include "../Output.h"
+#include "../PrimalSolver.h"
+#include "../Results.h"
+#include "../Settings.h"
+#include "../Timing.h"
+#include "../Utilities.h"
+
+#include "../Model/Problem.h"
+
+#include "CbcModel.hpp"
+#include "CoinPackedVector.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
+
+namespace SHOT
+{
+
+MIPSolverCbcSingleTree::MIPSolverCbcSingleTree(EnvironmentPtr envPtr) : MIPSolverCbc(envPtr) {}
+
+MIPSolverCbcSingleTree::~MIPSolverCbcSingleTree() = default;
+
+E_ProblemSolutionStatus MIPSolverCbcSingleTree::solveProblem()
+{
+    E_ProblemSolutionStatus MIPSolutionStatus = solveWithCallbacks();
+
+    // To find a feasible point for an unbounded dual problem
+    if(MIPSolutionStatus == E_ProblemSolutionStatus::Unbounded)
+    {
+        bool variableBoundsUpdated = false;
+
+        if((env->reformulatedProblem->objectiveFunction->properties.classification
+                   == E_ObjectiveFunctionClassification::Linear
+               && std::dynamic_pointer_cast<LinearObjectiveFunction>(env->reformulatedProblem->objectiveFunction)
+                      ->isDualUnbounded())
+            || (env->reformulatedProblem->objectiveFunction->properties.classification
+                       == E_ObjectiveFunctionClassification::Quadratic
+                   && std::dynamic_pointer_cast<QuadraticObjectiveFunction>(env->reformulatedProblem->objectiveFunction)
+                          ->isDualUnbounded()))
+        {
+            for(auto& V : env->reformulatedProblem->allVariables)
+            {
+                if(V->isDualUnbounded())
+                {
+                    updateVariableBound(
+                        V->index, -getUnboundedVariableBoundValue() / 10e30, getUnboundedVariableBoundValue() / 10e30);
+                    variableBoundsUpdated = true;
+                }
+            }
+        }
+
+        if(variableBoundsUpdated)
+        {
+            MIPSolutionStatus = solveWithCallbacks();
+
+            for(auto& V : env->reformulatedProblem->allVariables)
+            {
+                if(V->isDualUnbounded())
+                    updateVariableBound(V->index, V->lowerBound, V->upperBound);
+            }
+
+            env->results->getCurrentIteration()->hasInfeasibilityRepairBeenPerformed = true;
+        }
+    }
+
+    return (MIPSolutionStatus);
+}
+
+E_ProblemSolutionStatus MIPSolverCbcSingleTree::solveWithCallbacks()
+{
+    E_ProblemSolutionStatus MIPSolutionStatus;
+    cachedSolutionHasChanged = true;
+
+    try
+    {
+        if(!cbcCallback)
+        {
+            cbcCallback = std::make_unique<CbcCallback>(env);
+            cbcEventCallback = std::make_unique<CbcEventCallback>(env);
+        }
+
+        cbcModel = std::make_unique<CbcModel>(*osiInterface);
+
+        initializeSolverSettings();
+
+        // The callbacks are not thread safe
+        cbcModel->setNumberThreads(0);
+
+        // The MIP starts are only used by CbcMain1, which cannot be used since its preprocessing would change the
+        // problem the hyperplanes are generated for
+        MIPStarts.clear();
+
+        // The generator is called in every node and for each integer solution found, and the solution is rejected if
+        // it violates a generated cut
+        cbcModel->addCutGenerator(cbcCallback.get(), 1, "SHOT hyperplanes", true, true);
+        cbcModel->passInEventHandler(cbcEventCallback.get());
+
+        if(!env->settings->getSetting<bool>("Console.DualSolver.Show", "Output"))
+        {
+            cbcModel->setLogLevel(0);
+            cbcModel->solver()->setHintParam(OsiDoReducePrint, false, OsiHintTry);
+        }
+
+        cbcModel->initialSolve();
+        cbcModel->branchAndBound();
+
+        MIPSolutionStatus = getSolutionStatus();
+    }
+    catch(std::exception& e)
+    {
+        env->output->outputError("Error when solving subproblem with Cbc", e.what());
+        MIPSolutionStatus = E_ProblemSolutionStatus::Error;
+    }
+    catch(CoinError& e)
+    {
+        env->output->outputError("Error when solving subproblem with Cbc", e.message());
+        MIPSolutionStatus = E_ProblemSolutionStatus::Error;
+    }
+
+    return (MIPSolutionStatus);
+}
+
+E_ProblemSolutionStatus MIPSolverCbcSingleTree::getSolutionStatus()
+{
+    // The search has been stopped by the event handler
+    if(cbcModel->secondaryStatus() == 5)
+        return (E_ProblemSolutionStatus::Abort);
+
+    return (MIPSolverCbc::getSolutionStatus());
+}
+
+CbcCallback::CbcCallback(EnvironmentPtr envPtr)
+{
+    env = envPtr;
+
+    isMinimization = env->reformulatedProblem->objectiveFunction->properties.isMinimize;
+
+    env->solutionStatistics.iterationLastLazyAdded = 0;
+
+    if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
+            == ES_HyperplaneCutStrategy::ESH)
+        {
+            tUpdateInteriorPoint = std::make_shared<TaskUpdateInteriorPoint>(env);
+            taskSelectHPPts = std::make_shared<TaskSelectHyperplanePointsESH>(env);
+        }
+        else
+        {
+            taskSelectHPPts = std::make_shared<TaskSelectHyperplanePointsECP>(env);
+        }
+    }
+
+    tSelectPrimNLP = std::make_shared<TaskSelectPrimalCandidatesFromNLP>(env);
+
+    if(env->reformulatedProblem->objectiveFunction->properties.classification
+        > E_ObjectiveFunctionClassification::Quadratic)
+    {
+        taskSelectHPPtsByObjectiveRootsearch = std::make_shared<TaskSelectHyperplanePointsByObjectiveRootsearch>(env);
+    }
+
+    if(env->settings->getSetting<bool>("Rootsearch.Use", "Primal")
+        && env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        taskSelectPrimalSolutionFromRootsearch = std::make_shared<TaskSelectPrimalCandidatesFromRootsearch>(env);
+    }
+
+    lastUpdatedPrimal = env->results->getPrimalBound();
+}
+
+CbcCallback::~CbcCallback() = default;
+
+// Cbc uses a copy of the generator, which shares the tasks with the original
+CglCutGenerator* CbcCallback::clone() const { return (new CbcCallback(*this)); }
+
+void CbcCallback::generateCuts(const OsiSolverInterface& si, OsiCuts& cs, [[maybe_unused]] const CglTreeInfo info)
+{
+    try
+    {
+        int numberOfColumns = si.getNumCols();
+        int numberOfVariables
+            = (env->dualSolver->MIPSolver->hasDualAuxiliaryObjectiveVariable()) ? numberOfColumns - 1 : numberOfColumns;
+
+        const double* columnSolution = si.getColSolution();
+
+        auto cbcModel = static_cast<MIPSolverCbcSingleTree*>(env->dualSolver->MIPSolver.get())->getCbcModel();
+        double integerTolerance = cbcModel->getIntegerTolerance();
+        bool isIntegerFeasible = true;
+
+        for(int i = 0; i < numberOfColumns; i++)
+        {
+            if(si.isInteger(i) && std::abs(columnSolution[i] - std::round(columnSolution[i])) > integerTolerance)
+            {
+                isIntegerFeasible = false;
+                break;
+            }
+        }
+
+        SolutionPoint solution;
+        solution.point = VectorDouble(columnSolution, columnSolution + numberOfVariables);
+        solution.objectiveValue = si.getObjValue();
+        solution.iterFound = env->results->getCurrentIteration()->iterationNumber;
+
+        if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+        {
+            auto maxDev = env->reformulatedProblem->getMaxNumericConstraintValue(
+                solution.point, env->reformulatedProblem->nonlinearConstraints);
+            solution.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
+        }
+        else
+        {
+            solution.maxDeviation = PairIndexValue(-1, 0.0);
+        }
+
+        if(isIntegerFeasible)
+        {
+            addIntegerSolution(solution, cs);
+        }
+        else if(env->results->getCurrentIteration()->relaxedLazyHyperplanesAdded
+            < env->settings->getSetting<int>("Relaxation.MaxLazyConstraints", "Dual"))
+        {
+            solution.isRelaxedPoint = true;
+            addRelaxedSolution(solution);
+        }
+
+        for(auto& hp : env->dualSolver->hyperplaneWaitingList)
+        {
+            if(this->createHyperplane(hp, cs))
+                this->lastNumAddedHyperplanes++;
+        }
+
+        env->dualSolver->hyperplaneWaitingList.clear();
+    }
+    catch(CoinError& e)
+    {
+        env->output->outputError("Cbc error when generating lazy hyperplanes", e.message());
+    }
+}
+
+void CbcCallback::addRelaxedSolution(SolutionPoint& solution)
+{
+    int waitingListSize = env->dualSolver->hyperplaneWaitingList.size();
+
+    std::vector<SolutionPoint> solutionPoints = { solution };
+
+    if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
+            == ES_HyperplaneCutStrategy::ESH)
+        {
+            tUpdateInteriorPoint->run();
+            static_cast<TaskSelectHyperplanePointsESH*>(taskSelectHPPts.get())->run(solutionPoints);
+        }
+        else
+        {
+            static_cast<TaskSelectHyperplanePointsECP*>(taskSelectHPPts.get())->run(solutionPoints);
+        }
+    }
+
+    if(env->reformulatedProblem->objectiveFunction->properties.classification
+        > E_ObjectiveFunctionClassification::Quadratic)
+    {
+        taskSelectHPPtsByObjectiveRootsearch->run(solutionPoints);
+    }
+
+    env->results->getCurrentIteration()->relaxedLazyHyperplanesAdded
+        += (env->dualSolver->hyperplaneWaitingList.size() - waitingListSize);
+}
+
+void CbcCallback::addIntegerSolution(SolutionPoint& solution, OsiCuts& cuts)
+{
+    auto currIter = env->results->getCurrentIteration();
+
+    if(currIter->isSolved)
+    {
+        env->results->createIteration();
+        currIter = env->results->getCurrentIteration();
+        currIter->isDualProblemDiscrete = true;
+        currIter->dualProblemClass = env->dualSolver->MIPSolver->getProblemClass();
+        solution.iterFound = currIter->iterationNumber;
+    }
+
+    // Check for new primal solution
+    if((isMinimization && solution.objectiveValue < env->results->getPrimalBound())
+        || (!isMinimization && solution.objectiveValue > env->results->getPrimalBound()))
+    {
+        auto numberOfVariables
+            = std::min(solution.point.size(), (size_t)env->problem->properties.numberOfVariables);
+        VectorDouble primalSolution(solution.point.begin(), solution.point.begin() + numberOfVariables);
+
+        SolutionPoint tmpPt;
+
+        if(env->problem->properties.numberOfNonlinearConstraints > 0)
+        {
+            auto maxDev
+                = env->problem->getMaxNumericConstraintValue(primalSolution, env->problem->nonlinearConstraints);
+            tmpPt.maxDeviation = PairIndexValue(maxDev.constraint->index, maxDev.normalizedValue);
+        }
+        else
+        {
+            tmpPt.maxDeviation = PairIndexValue(-1, 0.0);
+        }
+
+        tmpPt.iterFound = currIter->iterationNumber;
+        tmpPt.objectiveValue = env->problem->objectiveFunction->calculateValue(primalSolution);
+        tmpPt.point = primalSolution;
+
+        env->primalSolver->addPrimalSolutionCandidate(tmpPt, E_PrimalSolutionSource::LazyConstraintCallback);
+    }
+
+    std::vector<SolutionPoint> candidatePoints { solution };
+
+    addLazyConstraint(candidatePoints);
+
+    auto cbcModel = static_cast<MIPSolverCbcSingleTree*>(env->dualSolver->MIPSolver.get())->getCbcModel();
+    int exploredNodes = cbcModel->getNodeCount();
+
+    currIter->maxDeviation = solution.maxDeviation.value;
+    currIter->maxDeviationConstraint = solution.maxDeviation.index;
+    currIter->solutionStatus = E_ProblemSolutionStatus::Feasible;
+    currIter->objectiveValue = solution.objectiveValue;
+
+    currIter->numberOfExploredNodes = exploredNodes - env->solutionStatistics.numberOfExploredNodes;
+    env->solutionStatistics.numberOfExploredNodes = exploredNodes;
+
+    auto bounds = std::make_pair(env->results->getCurrentDualBound(), env->results->getPrimalBound());
+    currIter->currentObjectiveBounds = bounds;
+
+    if(env->settings->getSetting<bool>("Rootsearch.Use", "Primal")
+        && env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        taskSelectPrimalSolutionFromRootsearch.get()->run(candidatePoints);
+        env->primalSolver->checkPrimalSolutionCandidates();
+    }
+
+    if(checkFixedNLPStrategy(candidatePoints.at(0)))
+    {
+        env->primalSolver->addFixedNLPCandidate(candidatePoints.at(0).point, E_PrimalNLPSource::FirstSolution,
+            solution.objectiveValue, currIter->iterationNumber, candidatePoints.at(0).maxDeviation);
+
+        tSelectPrimNLP.get()->run();
+        env->primalSolver->checkPrimalSolutionCandidates();
+    }
+
+    if(env->settings->getSetting<bool>("HyperplaneCuts.UseIntegerCuts", "Dual"))
+    {
+        int addedIntegerCuts = 0;
+
+        for(auto& IC : env->dualSolver->integerCutWaitingList)
+        {
+            if(this->createIntegerCut(IC.first, IC.second, cuts))
+                addedIntegerCuts++;
+        }
+
+        if(addedIntegerCuts > 0)
+            env->output->outputDebug(fmt::format("        Added {} integer cut(s)", addedIntegerCuts));
+
+        env->dualSolver->integerCutWaitingList.clear();
+    }
+
+    currIter->isSolved = true;
+
+    auto threadId = "";
+    printIterationReport(candidatePoints.at(0), threadId);
+}
+
+bool CbcCallback::createHyperplane(Hyperplane hyperplane, OsiCuts& cuts)
+{
+    auto optionalHyperplanes = env->dualSolver->MIPSolver->createHyperplaneTerms(hyperplane);
+
+    if(!optionalHyperplanes)
+        return (false);
+
+    auto tmpPair = optionalHyperplanes.value();
+
+    CoinPackedVector row;
+
+    for(auto& E : tmpPair.first)
+    {
+        if(E.second != E.second) // Check for NaN
+        {
+            env->output->outputError("     Warning: hyperplane for constraint "
+                + std::to_string(hyperplane.sourceConstraint->index)
+                + " not generated, NaN found in linear terms for variable "
+                + env->problem->getVariable(E.first)->name);
+            return (false);
+        }
+
+        row.insert(E.first, E.second);
+    }
+
+    OsiRowCut cut;
+    cut.setRow(row);
+    cut.setLb(-COIN_DBL_MAX);
+    cut.setUb(-tmpPair.second);
+    cut.setGloballyValid(true);
+
+    cuts.insert(cut);
+
+    env->dualSolver->addGeneratedHyperplane(hyperplane);
+
+    return (true);
+}
+
+bool CbcCallback::createIntegerCut(
+    VectorInteger& binaryIndexesOnes, VectorInteger& binaryIndexesZeroes, OsiCuts& cuts)
+{
+    CoinPackedVector row;
+
+    for(int I : binaryIndexesOnes)
+        row.insert(I, 1.0);
+
+    for(int I : binaryIndexesZeroes)
+        row.insert(I, -1.0);
+
+    OsiRowCut cut;
+    cut.setRow(row);
+    cut.setLb(-COIN_DBL_MAX);
+    cut.setUb(binaryIndexesOnes.size() - 1.0);
+    cut.setGloballyValid(true);
+
+    cuts.insert(cut);
+
+    env->solutionStatistics.numberOfIntegerCuts++;
+
+    return (true);
+}
+
+void CbcCallback::addLazyConstraint(std::vector<SolutionPoint> candidatePoints)
+{
+    if(env->reformulatedProblem->properties.numberOfNonlinearConstraints > 0)
+    {
+        if(static_cast<ES_HyperplaneCutStrategy>(env->settings->getSetting<int>("CutStrategy", "Dual"))
+            == ES_HyperplaneCutStrategy::ESH)
+        {
+            tUpdateInteriorPoint->run();
+            static_cast<TaskSelectHyperplanePointsESH*>(taskSelectHPPts.get())->run(candidatePoints);
+        }
+        else
+        {
+            static_cast<TaskSelectHyperplanePointsECP*>(taskSelectHPPts.get())->run(candidatePoints);
+        }
+    }
+
+    if(env->reformulatedProblem->objectiveFunction->properties.classification
+        > E_ObjectiveFunctionClassification::Quadratic)
+    {
+        taskSelectHPPtsByObjectiveRootsearch->run(candidatePoints);
+    }
+}
+
+CbcEventCallback::CbcEventCallback(EnvironmentPtr envPtr)
+{
+    env = envPtr;
+    isMinimization = env->reformulatedProblem->objectiveFunction->properties.isMinimize;
+}
+
+CbcEventCallback::~CbcEventCallback() = default;
+
+CbcEventHandler* CbcEventCallback::clone() const { return (new CbcEventCallback(*this)); }
+
+CbcEventHandler::CbcAction CbcEventCallback::event(CbcEvent whichEvent)
+{
+    if(whichEvent != node && whichEvent != solution)
+        return (noAction);
+
+    // Check if better dual bound
+    double dualBound = model_->getBestPossibleObjValue();
+
+    if(std::abs(dualBound) < 1e50
+        && ((isMinimization && dualBound > env->results->getCurrentDualBound())
+            || (!isMinimization && dualBound < env->results->getCurrentDualBound())))
+    {
+        VectorDouble doubleSolution; // Empty since we have no point
+
+        DualSolution sol = { doubleSolution, E_DualSolutionSource::MIPSolverBound, dualBound,
+            env->results->getCurrentIteration()->iterationNumber, false };
+        env->dualSolver->addDualSolutionCandidate(sol);
+    }
+
+    if(env->results->isAbsoluteObjectiveGapToleranceMet() || env->results->isRelativeObjectiveGapToleranceMet()
+        || checkIterationLimit() || checkUserTermination())
+    {
+        return (stop);
+    }
+
+    return (noAction);
+}
+} // namespace SHOT
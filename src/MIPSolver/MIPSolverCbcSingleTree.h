@@ -0,0 +1,77 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+#include "MIPSolverBase.h"
+#include "MIPSolverCbc.h"
+#include "MIPSolverCallbackBase.h"
+
+#include "CbcEventHandler.hpp"
+#include "CglCutGenerator.hpp"
+
+class OsiCuts;
+
+namespace SHOT
+{
+
+// Generates the hyperplanes as globally valid cuts in the nodes of the branch-and-bound tree. Since the generator is
+// also called for each integer solution found, the cuts act as lazy constraints.
+class CbcCallback : public CglCutGenerator, public MIPSolverCallbackBase
+{
+public:
+    CbcCallback(EnvironmentPtr envPtr);
+    ~CbcCallback() override;
+
+    void generateCuts(const OsiSolverInterface& si, OsiCuts& cs, const CglTreeInfo info = CglTreeInfo()) override;
+
+    CglCutGenerator* clone() const override;
+
+private:
+    void addIntegerSolution(SolutionPoint& solution, OsiCuts& cuts);
+    void addRelaxedSolution(SolutionPoint& solution);
+
+    bool createHyperplane(Hyperplane hyperplane, OsiCuts& cuts);
+
+    bool createIntegerCut(VectorInteger& binaryIndexesOnes, VectorInteger& binaryIndexesZeroes, OsiCuts& cuts);
+
+    void addLazyConstraint(std::vector<SolutionPoint> candidatePoints);
+};
+
+// Updates the dual bound and stops the search when a termination criterion has been met
+class CbcEventCallback : public CbcEventHandler, public MIPSolverCallbackBase
+{
+public:
+    CbcEventCallback(EnvironmentPtr envPtr);
+    ~CbcEventCallback() override;
+
+    CbcAction event(CbcEvent whichEvent) override;
+
+    CbcEventHandler* clone() const override;
+};
+
+class MIPSolverCbcSingleTree : public MIPSolverCbc
+{
+public:
+    MIPSolverCbcSingleTree(EnvironmentPtr envPtr);
+    ~MIPSolverCbcSingleTree() override;
+
+    E_ProblemSolutionStatus solveProblem() override;
+
+    E_ProblemSolutionStatus getSolutionStatus() override;
+
+    inline CbcModel* getCbcModel() { return (cbcModel.get()); }
+
+private:
+    E_ProblemSolutionStatus solveWithCallbacks();
+
+    std::unique_ptr<CbcCallback> cbcCallback;
+    std::unique_ptr<CbcEventCallback> cbcEventCallback;
+};
+} // namespace SHOT
@@ -469,6 +469,41 @@ int MIPSolverCplex::addLinearConstraint(
     return (cplexInstance.getNrows() - 1);
 }
 
+int MIPSolverCplex::addLinearConstraints(const LinearConstraintRows& rows)
+{
+    try
+    {
+        IloRangeArray ranges(cplexEnv);
+
+        for(size_t i = 0; i < rows.size(); i++)
+        {
+            IloExpr expr(cplexEnv);
+
+            for(int j = rows.rowStarts[i]; j < rows.rowStarts[i + 1]; j++)
+                expr += rows.coefficients[j] * cplexVars[rows.columnIndices[j]];
+
+            ranges.add(IloRange(cplexEnv, -IloInfinity, expr, -rows.constants[i], rows.names[i].c_str()));
+
+            expr.end();
+        }
+
+        cplexModel.add(ranges);
+        cplexConstrs.add(ranges);
+
+        ranges.end();
+
+        modelUpdated = true;
+    }
+    catch(IloException& e)
+    {
+        env->output->outputError("        Error when adding linear constraints", e.getMessage());
+
+        return (-1);
+    }
+
+    return (cplexInstance.getNrows() - static_cast<int>(rows.size()));
+}
+
 void MIPSolverCplex::activateDiscreteVariables(bool activate)
 {
     try
@@ -446,6 +446,38 @@ int MIPSolverGurobi::addLinearConstraint(
     return (gurobiModel->get(GRB_IntAttr_NumConstrs) - 1);
 }
 
+int MIPSolverGurobi::addLinearConstraints(const LinearConstraintRows& rows)
+{
+    try
+    {
+        std::vector<GRBLinExpr> expressions(rows.size());
+        std::vector<char> senses(rows.size(), GRB_LESS_EQUAL);
+        VectorDouble rightHandSides(rows.size());
+
+        for(size_t i = 0; i < rows.size(); i++)
+        {
+            for(int j = rows.rowStarts[i]; j < rows.rowStarts[i + 1]; j++)
+                expressions[i] += rows.coefficients[j] * gurobiModel->getVar(rows.columnIndices[j]);
+
+            rightHandSides[i] = -rows.constants[i];
+        }
+
+        auto constraints = gurobiModel->addConstrs(expressions.data(), senses.data(), rightHandSides.data(),
+            rows.names.data(), static_cast<int>(rows.size()));
+        delete[] constraints;
+
+        modelUpdated = true;
+    }
+    catch(GRBException& e)
+    {
+        env->output->outputError("        Error when adding linear constraints", e.getMessage());
+
+        return (-1);
+    }
+
+    return (gurobiModel->get(GRB_IntAttr_NumConstrs) - static_cast<int>(rows.size()));
+}
+
 bool MIPSolverGurobi::createIntegerCut(VectorInteger& binaryIndexesOnes, VectorInteger& binaryIndexesZeroes)
 {
     try
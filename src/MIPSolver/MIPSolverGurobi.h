@@ -53,8 +53,21 @@ public:
     int addLinearConstraint(
         const std::map<int, double>& elements, double constant, std::string name, bool isGreaterThan) override;
 
+    int addLinearConstraints(const LinearConstraintRows& rows) override;
+
+    // Not supported, since the repair of infeasible dual problems relies on the order of the added constraints
+    bool removeLinearConstraints([[maybe_unused]] const VectorInteger& constraintIndices) override
+    {
+        return (false);
+    }
+
     bool createHyperplane(Hyperplane hyperplane) override { return (MIPSolverBase::createHyperplane(hyperplane)); }
 
+    std::vector<bool> createHyperplanes(const std::vector<Hyperplane>& hyperplanes) override
+    {
+        return (MIPSolverBase::createHyperplanes(hyperplanes));
+    }
+
     bool createIntegerCut(VectorInteger& binaryIndexesOnes, VectorInteger& binaryIndexesZeroes) override;
 
     bool createInteriorHyperplane(Hyperplane hyperplane) override
@@ -99,7 +112,10 @@ public:
     E_ProblemSolutionStatus getSolutionStatus() override;
     int getNumberOfSolutions() override;
     VectorDouble getVariableSolution(int solIdx) override;
-    std::vector<SolutionPoint> getAllVariableSolutions() override { return (MIPSolverBase::getAllVariableSolutions()); }
+    const std::vector<SolutionPoint>& getAllVariableSolutions() override
+    {
+        return (MIPSolverBase::getAllVariableSolutions());
+    }
     double getDualObjectiveValue() override;
     double getObjectiveValue(int solIdx) override;
     double getObjectiveValue() override { return (MIPSolverBase::getObjectiveValue()); }
@@ -119,10 +119,38 @@ std::shared_ptr<std::vector<std::pair<VariablePtr, VariablePtr>>> NumericConstra
     return (hessianSparsityPattern);
 }
 
+void NumericConstraint::calculateFunctionValues(const double* points, size_t numberOfPoints, double* values)
+{
+    auto numberOfVariables = ownerProblem.lock()->properties.numberOfVariables;
+    VectorDouble point(numberOfVariables);
+
+    for(size_t i = 0; i < numberOfPoints; i++)
+    {
+        for(int j = 0; j < numberOfVariables; j++)
+            point[j] = points[j * numberOfPoints + i];
+
+        values[i] = calculateFunctionValue(point);
+    }
+}
+
+double NumericConstraint::calculateFunctionValue(
+    const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative)
+{
+    directionalDerivative = 0.0;
+
+    for(auto& E : calculateGradient(point, false))
+        directionalDerivative += E.second * direction[E.first->index];
+
+    return (calculateFunctionValue(point));
+}
+
 NumericConstraintValue NumericConstraint::calculateNumericValue(const VectorDouble& point, double correction)
 {
-    double value = calculateFunctionValue(point) - correction;
+    return (getNumericValue(calculateFunctionValue(point) - correction));
+}
 
+NumericConstraintValue NumericConstraint::getNumericValue(double value)
+{
     NumericConstraintValue constrValue;
     constrValue.constraint = getPointer();
     constrValue.functionValue = value;
@@ -176,6 +204,23 @@ double LinearConstraint::calculateFunctionValue(const VectorDouble& point)
     return value;
 }
 
+void LinearConstraint::calculateFunctionValues(const double* points, size_t numberOfPoints, double* values)
+{
+    std::fill(values, values + numberOfPoints, constant);
+    linearTerms.calculate(points, numberOfPoints, values);
+}
+
+double LinearConstraint::calculateFunctionValue(
+    const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative)
+{
+    directionalDerivative = 0.0;
+
+    for(auto& T : linearTerms)
+        directionalDerivative += T->coefficient * direction[T->variable->index];
+
+    return (LinearConstraint::calculateFunctionValue(point));
+}
+
 Interval LinearConstraint::calculateFunctionValue(const IntervalVector& intervalVector)
 {
     Interval value = linearTerms.calculate(intervalVector);
@@ -292,6 +337,29 @@ double QuadraticConstraint::calculateFunctionValue(const VectorDouble& point)
     return value;
 }
 
+void QuadraticConstraint::calculateFunctionValues(const double* points, size_t numberOfPoints, double* values)
+{
+    LinearConstraint::calculateFunctionValues(points, numberOfPoints, values);
+    quadraticTerms.calculate(points, numberOfPoints, values);
+}
+
+double QuadraticConstraint::calculateFunctionValue(
+    const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative)
+{
+    double value = LinearConstraint::calculateFunctionValue(point, direction, directionalDerivative);
+
+    for(auto& T : quadraticTerms)
+    {
+        int firstIndex = T->firstVariable->index;
+        int secondIndex = T->secondVariable->index;
+
+        directionalDerivative += T->coefficient
+            * (point[firstIndex] * direction[secondIndex] + point[secondIndex] * direction[firstIndex]);
+    }
+
+    return (value + quadraticTerms.calculate(point));
+}
+
 Interval QuadraticConstraint::calculateFunctionValue(const IntervalVector& intervalVector)
 {
     Interval value = LinearConstraint::calculateFunctionValue(intervalVector);
@@ -506,7 +574,7 @@ void NonlinearConstraint::add(NonlinearExpressionPtr expression)
         NonlinearExpressions terms;
         terms.push_back(nonlinearExpression);
         terms.push_back(expression);
-        nonlinearExpression = std::make_shared<ExpressionSum>(std::move(terms));
+        nonlinearExpression = makeExpression<ExpressionSum>(std::move(terms));
     }
     else
     {
@@ -521,8 +589,19 @@ void NonlinearConstraint::updateFactorableFunction()
     factorableFunction = std::make_shared<FactorableFunction>(nonlinearExpression->getFactorableFunction());
 }
 
+void NonlinearConstraint::updateNonlinearExpressionTape()
+{
+    if(properties.hasNonlinearExpression)
+        nonlinearExpressionTape.compile(nonlinearExpression);
+    else
+        nonlinearExpressionTape.clear();
+}
+
 double NonlinearConstraint::calculateFunctionValue(const VectorDouble& point)
 {
+    if(compiledFunction.isLoaded())
+        return (compiledFunction.calculateValue(point));
+
     double value = QuadraticConstraint::calculateFunctionValue(point);
 
     if(this->properties.hasMonomialTerms)
@@ -532,11 +611,104 @@ double NonlinearConstraint::calculateFunctionValue(const VectorDouble& point)
         value += signomialTerms.calculate(point);
 
     if(this->properties.hasNonlinearExpression)
-        value += nonlinearExpression->calculate(point);
+    {
+        if(nonlinearExpressionTape.isCompiledFrom(nonlinearExpression))
+            value += nonlinearExpressionTape.calculate(point);
+        else
+            value += nonlinearExpression->calculate(point);
+    }
 
     return value;
 }
 
+double NonlinearConstraint::calculateFunctionValue(
+    const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative)
+{
+    if(compiledFunction.isLoaded())
+    {
+        thread_local VectorDouble gradient;
+        gradient.resize(compiledFunction.gradientVariables.size());
+
+        double value = compiledFunction.calculateGradient(point, gradient.data());
+
+        directionalDerivative = 0.0;
+
+        for(size_t i = 0; i < gradient.size(); i++)
+            directionalDerivative += gradient[i] * direction[compiledFunction.gradientVariables[i]->index];
+
+        return (value);
+    }
+
+    // The expression tree itself has no derivatives, so the gradient is used instead
+    if(this->properties.hasNonlinearExpression && !nonlinearExpressionTape.isCompiledFrom(nonlinearExpression))
+        return (NumericConstraint::calculateFunctionValue(point, direction, directionalDerivative));
+
+    double value = QuadraticConstraint::calculateFunctionValue(point, direction, directionalDerivative);
+
+    if(this->properties.hasMonomialTerms)
+    {
+        value += monomialTerms.calculate(point);
+
+        for(auto& E : monomialTerms.calculateGradient(point))
+            directionalDerivative += E.second * direction[E.first->index];
+    }
+
+    if(this->properties.hasSignomialTerms)
+    {
+        value += signomialTerms.calculate(point);
+
+        for(auto& E : signomialTerms.calculateGradient(point))
+            directionalDerivative += E.second * direction[E.first->index];
+    }
+
+    if(this->properties.hasNonlinearExpression)
+    {
+        double expressionDerivative;
+        value += nonlinearExpressionTape.calculate(point, direction, expressionDerivative);
+        directionalDerivative += expressionDerivative;
+    }
+
+    return value;
+}
+
+void NonlinearConstraint::calculateFunctionValues(const double* points, size_t numberOfPoints, double* values)
+{
+    if(compiledFunction.isLoaded())
+    {
+        NumericConstraint::calculateFunctionValues(points, numberOfPoints, values);
+        return;
+    }
+
+    QuadraticConstraint::calculateFunctionValues(points, numberOfPoints, values);
+
+    if(this->properties.hasMonomialTerms)
+        monomialTerms.calculate(points, numberOfPoints, values);
+
+    if(this->properties.hasSignomialTerms)
+        signomialTerms.calculate(points, numberOfPoints, values);
+
+    if(this->properties.hasNonlinearExpression)
+    {
+        if(nonlinearExpressionTape.isCompiledFrom(nonlinearExpression))
+        {
+            nonlinearExpressionTape.calculate(points, numberOfPoints, values);
+        }
+        else
+        {
+            auto numberOfVariables = ownerProblem.lock()->properties.numberOfVariables;
+            VectorDouble point(numberOfVariables);
+
+            for(size_t i = 0; i < numberOfPoints; i++)
+            {
+                for(int j = 0; j < numberOfVariables; j++)
+                    point[j] = points[j * numberOfPoints + i];
+
+                values[i] += nonlinearExpression->calculate(point);
+            }
+        }
+    }
+}
+
 Interval NonlinearConstraint::calculateFunctionValue(const IntervalVector& intervalVector)
 {
     Interval value = QuadraticConstraint::calculateFunctionValue(intervalVector);
@@ -578,21 +750,10 @@ Interval NonlinearConstraint::getConstraintFunctionBounds()
 
 SparseVariableVector NonlinearConstraint::calculateGradient(const VectorDouble& point, bool eraseZeroes = true)
 {
-    SparseVariableVector gradient = QuadraticConstraint::calculateGradient(point, eraseZeroes);
-
-    SparseVariableVector monomialGradient;
+    if(compiledFunction.isLoaded())
+        return (compiledFunction.calculateGradient(point, eraseZeroes));
 
-    if(this->properties.hasMonomialTerms)
-    {
-        monomialGradient = monomialTerms.calculateGradient(point);
-    }
-
-    SparseVariableVector signomialGradient;
-
-    if(this->properties.hasSignomialTerms)
-    {
-        signomialGradient = signomialTerms.calculateGradient(point);
-    }
+    SparseVariableVector nonlinearExpressionGradient;
 
     if(this->properties.hasNonlinearExpression)
     {
@@ -625,17 +786,35 @@ SparseVariableVector NonlinearConstraint::calculateGradient(const VectorDouble&
 
                 auto VAR = sharedOwnerProblem->nonlinearVariables[col[k]];
 
-                auto element = gradient.emplace(VAR, coefficient);
-
-                if(!element.second)
-                {
-                    // Element already exists for the variable
-                    element.first->second += coefficient;
-                }
+                nonlinearExpressionGradient.add(VAR, coefficient);
             }
         }
     }
 
+    return (calculateGradient(point, nonlinearExpressionGradient, eraseZeroes));
+}
+
+SparseVariableVector NonlinearConstraint::calculateGradient(
+    const VectorDouble& point, const SparseVariableVector& nonlinearExpressionGradient, bool eraseZeroes)
+{
+    SparseVariableVector gradient = QuadraticConstraint::calculateGradient(point, eraseZeroes);
+
+    SparseVariableVector monomialGradient;
+
+    if(this->properties.hasMonomialTerms)
+    {
+        monomialGradient = monomialTerms.calculateGradient(point);
+    }
+
+    SparseVariableVector signomialGradient;
+
+    if(this->properties.hasSignomialTerms)
+    {
+        signomialGradient = signomialTerms.calculateGradient(point);
+    }
+
+    gradient.add(nonlinearExpressionGradient);
+
     auto result = Utilities::combineSparseVariableVectors(gradient, monomialGradient, signomialGradient);
 
     if(eraseZeroes)
@@ -908,8 +1087,6 @@ void NonlinearConstraint::takeOwnership(ProblemPtr owner)
     QuadraticConstraint::takeOwnership(owner);
     monomialTerms.takeOwnership(owner);
     signomialTerms.takeOwnership(owner);
-    if(nonlinearExpression != nullptr)
-        nonlinearExpression->takeOwnership(owner);
 }
 
 NumericConstraintValue NonlinearConstraint::calculateNumericValue(
@@ -19,6 +19,8 @@
 #include "Variables.h"
 #include "Terms.h"
 #include "NonlinearExpressions.h"
+#include "NonlinearExpressionTape.h"
+#include "ModelCodeGenerator.h"
 
 #include "cppad/cppad.hpp"
 #include "cppad/utility.hpp"
@@ -128,6 +130,14 @@ public:
     virtual double calculateFunctionValue(const VectorDouble& point) = 0;
     virtual Interval calculateFunctionValue(const IntervalVector& intervalVector) = 0;
 
+    // Calculates the function value in each of the points. The points are given as a column-major block, i.e. the
+    // value of the variable with index j in point i is points[j * numberOfPoints + i]
+    virtual void calculateFunctionValues(const double* points, size_t numberOfPoints, double* values);
+
+    // Calculates the function value and the derivative of the function along the direction
+    virtual double calculateFunctionValue(
+        const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative);
+
     virtual Interval getConstraintFunctionBounds() = 0;
 
     virtual SparseVariableVector calculateGradient(const VectorDouble& point, bool eraseZeroes) = 0;
@@ -139,6 +149,9 @@ public:
 
     virtual NumericConstraintValue calculateNumericValue(const VectorDouble& point, double correction = 0.0);
 
+    // Creates the numeric constraint value from an already calculated function value
+    NumericConstraintValue getNumericValue(double functionValue);
+
     bool isFulfilled(const VectorDouble& point) override;
 
     void takeOwnership(ProblemPtr owner) override = 0;
@@ -184,6 +197,11 @@ public:
     double calculateFunctionValue(const VectorDouble& point) override;
     Interval calculateFunctionValue(const IntervalVector& intervalVector) override;
 
+    void calculateFunctionValues(const double* points, size_t numberOfPoints, double* values) override;
+
+    double calculateFunctionValue(
+        const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative) override;
+
     Interval getConstraintFunctionBounds() override;
 
     bool isFulfilled(const VectorDouble& point) override;
@@ -262,6 +280,11 @@ public:
     double calculateFunctionValue(const VectorDouble& point) override;
     Interval calculateFunctionValue(const IntervalVector& intervalVector) override;
 
+    void calculateFunctionValues(const double* points, size_t numberOfPoints, double* values) override;
+
+    double calculateFunctionValue(
+        const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative) override;
+
     Interval getConstraintFunctionBounds() override;
 
     bool isFulfilled(const VectorDouble& point) override;
@@ -300,6 +323,12 @@ public:
     NonlinearExpressionPtr nonlinearExpression;
     FactorableFunctionPtr factorableFunction;
 
+    // The compiled nonlinear expression, used instead of the expression tree when evaluating function values
+    NonlinearExpressionTape nonlinearExpressionTape;
+
+    // The whole function as compiled code, used instead of all the other evaluations if loaded
+    CompiledFunction compiledFunction;
+
     CppAD::sparse_rc<std::vector<size_t>> nonlinearGradientSparsityPattern;
     CppAD::sparse_rc<std::vector<size_t>> nonlinearHessianSparsityPattern;
 
@@ -389,13 +418,23 @@ public:
     void add(NonlinearExpressionPtr expression);
 
     void updateFactorableFunction();
+    void updateNonlinearExpressionTape();
 
     double calculateFunctionValue(const VectorDouble& point) override;
 
+    void calculateFunctionValues(const double* points, size_t numberOfPoints, double* values) override;
+
+    double calculateFunctionValue(
+        const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative) override;
+
     Interval getConstraintFunctionBounds() override;
 
     SparseVariableVector calculateGradient(const VectorDouble& point, bool eraseZeroes) override;
 
+    // Calculates the gradient when the gradient of the nonlinear expression has already been calculated in the point
+    SparseVariableVector calculateGradient(
+        const VectorDouble& point, const SparseVariableVector& nonlinearExpressionGradient, bool eraseZeroes);
+
     // Returns the upper triagonal part of the Hessian matrix is sparse representation
     SparseVariableMatrix calculateHessian(const VectorDouble& point, bool eraseZeroes) override;
 
@@ -0,0 +1,69 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "ExpressionArena.h"
+
+#include <algorithm>
+
+namespace SHOT
+{
+
+namespace
+{
+    thread_local std::shared_ptr<ExpressionArena> currentArena;
+
+    constexpr size_t maximumBlockSize = 4 * 1024 * 1024;
+    constexpr size_t alignment = alignof(std::max_align_t);
+}
+
+void* ExpressionArena::allocate(size_t size)
+{
+    size = (size + alignment - 1) / alignment * alignment;
+
+    if(size > remainingSize)
+    {
+        // Large requests get a block of their own, so that the remaining space in the current block is not wasted
+        if(size > nextBlockSize / 4)
+        {
+            blocks.emplace_back(new std::byte[size]);
+            allocatedSize += size;
+            return (blocks.back().get());
+        }
+
+        blocks.emplace_back(new std::byte[nextBlockSize]);
+        allocatedSize += nextBlockSize;
+
+        position = blocks.back().get();
+        remainingSize = nextBlockSize;
+
+        nextBlockSize = std::min(2 * nextBlockSize, maximumBlockSize);
+    }
+
+    void* memory = position;
+    position += size;
+    remainingSize -= size;
+
+    return (memory);
+}
+
+std::shared_ptr<ExpressionArena> ExpressionArena::startNew()
+{
+    currentArena = std::make_shared<ExpressionArena>();
+    return (currentArena);
+}
+
+const std::shared_ptr<ExpressionArena>& ExpressionArena::getCurrent()
+{
+    if(!currentArena)
+        currentArena = std::make_shared<ExpressionArena>();
+
+    return (currentArena);
+}
+} // namespace SHOT
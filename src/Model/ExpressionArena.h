@@ -0,0 +1,89 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace SHOT
+{
+
+// Memory for the nonlinear expression nodes. The nodes are placed one after another in large blocks, which are freed
+// together when the last node allocated in the arena has been destroyed. Each problem starts a new arena for the
+// thread it is created in, so that the nodes of a problem are stored contiguously and released with the problem.
+class ExpressionArena
+{
+public:
+    ExpressionArena() = default;
+    ExpressionArena(const ExpressionArena&) = delete;
+    ExpressionArena& operator=(const ExpressionArena&) = delete;
+
+    // Only called from the thread in which the arena is the current one
+    void* allocate(size_t size);
+
+    inline size_t getNumberOfBlocks() const { return (blocks.size()); }
+    inline size_t getAllocatedSize() const { return (allocatedSize); }
+
+    // Replaces the arena used by makeExpression in the current thread with a new one
+    static std::shared_ptr<ExpressionArena> startNew();
+
+    // The arena used by makeExpression in the current thread
+    static const std::shared_ptr<ExpressionArena>& getCurrent();
+
+private:
+    std::vector<std::unique_ptr<std::byte[]>> blocks;
+
+    std::byte* position = nullptr;
+    size_t remainingSize = 0;
+    size_t nextBlockSize = 16 * 1024;
+    size_t allocatedSize = 0;
+};
+
+// Allocator that keeps the arena alive as long as any node allocated in it exists. Memory is not reused for
+// individual nodes, it is released all at once with the arena.
+template <typename T> class ExpressionAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ExpressionAllocator(std::shared_ptr<ExpressionArena> arena) : arena(std::move(arena)) {}
+
+    template <typename U> ExpressionAllocator(const ExpressionAllocator<U>& other) : arena(other.arena) {}
+
+    inline T* allocate(size_t number) { return (static_cast<T*>(arena->allocate(number * sizeof(T)))); }
+
+    inline void deallocate(T*, size_t) {}
+
+    template <typename U> inline bool operator==(const ExpressionAllocator<U>& other) const
+    {
+        return (arena == other.arena);
+    }
+
+    template <typename U> inline bool operator!=(const ExpressionAllocator<U>& other) const
+    {
+        return (arena != other.arena);
+    }
+
+private:
+    std::shared_ptr<ExpressionArena> arena;
+
+    template <typename U> friend class ExpressionAllocator;
+};
+
+// Creates a nonlinear expression node in the current arena, use instead of std::make_shared
+template <typename T, typename... Args> inline std::shared_ptr<T> makeExpression(Args&&... args)
+{
+    return (std::allocate_shared<T>(
+        ExpressionAllocator<T>(ExpressionArena::getCurrent()), std::forward<Args>(args)...));
+}
+} // namespace SHOT
@@ -0,0 +1,553 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "ModelCodeGenerator.h"
+
+#include "../Output.h"
+#include "../Settings.h"
+#include "../Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+
+#ifdef HAS_STD_FILESYSTEM
+#include <filesystem>
+namespace fs = std;
+#endif
+
+#ifdef HAS_STD_EXPERIMENTAL_FILESYSTEM
+#include <experimental/filesystem>
+namespace fs = std::experimental;
+#endif
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+namespace SHOT
+{
+
+SparseVariableVector CompiledFunction::calculateGradient(const VectorDouble& point, bool eraseZeroes) const
+{
+    thread_local std::vector<double> values;
+
+    if(values.size() < gradientVariables.size())
+        values.resize(gradientVariables.size());
+
+    gradientFunction(point.data(), values.data());
+
+    SparseVariableVector gradient;
+    gradient.reserve(gradientVariables.size());
+
+    // The variables are ordered by index, so the elements can be appended directly
+    for(size_t i = 0; i < gradientVariables.size(); i++)
+    {
+        if(eraseZeroes && values[i] == 0.0)
+            continue;
+
+        gradient.emplace(gradientVariables[i], values[i]);
+    }
+
+    return (gradient);
+}
+
+void CompiledFunction::clear()
+{
+    valueFunction = nullptr;
+    gradientFunction = nullptr;
+    gradientVariables.clear();
+    library.reset();
+}
+
+int ModelCodeGenerator::add(const LinearTerms& linearTerms, const QuadraticTerms& quadraticTerms,
+    const MonomialTerms& monomialTerms, const SignomialTerms& signomialTerms,
+    const NonlinearExpressionPtr& nonlinearExpression, double constant)
+{
+    Function function;
+    std::vector<Operand> terms;
+
+    for(auto& T : linearTerms)
+    {
+        if(T->coefficient != 0.0)
+            terms.push_back(addProduct(function, T->coefficient, { addVariable(function, T->variable) }));
+    }
+
+    for(auto& T : quadraticTerms)
+    {
+        if(T->coefficient != 0.0)
+        {
+            terms.push_back(addProduct(function, T->coefficient,
+                { addVariable(function, T->firstVariable), addVariable(function, T->secondVariable) }));
+        }
+    }
+
+    for(auto& T : monomialTerms)
+    {
+        if(T->coefficient == 0.0)
+            continue;
+
+        std::vector<Operand> factors;
+
+        for(auto& V : T->variables)
+            factors.push_back(addVariable(function, V));
+
+        terms.push_back(addProduct(function, T->coefficient, factors));
+    }
+
+    for(auto& T : signomialTerms)
+    {
+        if(T->coefficient == 0.0)
+            continue;
+
+        std::vector<Operand> factors;
+
+        for(auto& E : T->elements)
+        {
+            auto variable = addVariable(function, E->variable);
+            std::string base = getString(variable);
+            std::string power = getString(Operand{ -1, E->power });
+
+            std::string derivativePower = getString(Operand{ -1, E->power - 1.0 });
+
+            factors.push_back(addNode(function, fmt::format("pow({}, {})", base, power),
+                { { variable, fmt::format("{} * pow({}, {})", power, base, derivativePower) } }));
+        }
+
+        terms.push_back(addProduct(function, T->coefficient, factors));
+    }
+
+    if(nonlinearExpression)
+        terms.push_back(addExpression(function, nonlinearExpression.get()));
+
+    int index = functions.size();
+    generateCode(function, terms, constant, index);
+
+    functions.push_back(std::move(function));
+    return (index);
+}
+
+std::string ModelCodeGenerator::getCode() const
+{
+    std::stringstream code;
+
+    code << "/* Generated by SHOT */\n\n";
+    code << "#include <math.h>\n\n";
+
+    // Same special cases as in ExpressionPower::calculate
+    code << "static double shot_pow(double base, double exponent)\n";
+    code << "{\n";
+    code << "    if(fabs(base - 0.0) <= 1e-10 * fabs(base)) return 0.0;\n";
+    code << "    if(fabs(base - 1.0) <= 1e-10 * fabs(base)) return 1.0;\n";
+    code << "    if(fabs(exponent - 0.0) <= 1e-10 * fabs(base)) return 1.0;\n";
+    code << "    if(fabs(exponent - 1.0) <= 1e-10 * fabs(base)) return base;\n";
+    code << "    return pow(base, exponent);\n";
+    code << "}\n";
+
+    for(auto& F : functions)
+        code << F.code;
+
+    return (code.str());
+}
+
+std::vector<CompiledFunction> ModelCodeGenerator::compile()
+{
+    std::vector<CompiledFunction> compiledFunctions;
+
+#if defined(_WIN32)
+    env->output->outputWarning(" Compiled model functions are not supported on this platform.");
+    return (compiledFunctions);
+#else
+    std::string code = getCode();
+
+    fs::filesystem::path cachePath(
+        env->settings->getSetting<std::string>("NonlinearExpressions.CompiledCode.CachePath", "Model"));
+
+    if(cachePath.empty())
+        cachePath = fs::filesystem::temp_directory_path() / "shot_compiled";
+
+    std::error_code errorCode;
+    fs::filesystem::create_directories(cachePath, errorCode);
+
+    // The libraries are cached by the hash of the generated code, i.e. of the model functions
+    std::string name = fmt::format("shot_{:016x}", std::hash<std::string>{}(code));
+    auto sourceFile = cachePath / (name + ".c");
+    auto libraryFile = cachePath / (name + ".so");
+
+    // The library is only reused if the stored source is identical, since the hash may collide
+    bool isCached = fs::filesystem::exists(libraryFile) && fs::filesystem::exists(sourceFile)
+        && Utilities::getFileAsString(sourceFile.string()) == code;
+
+    if(isCached)
+    {
+        env->output->outputDebug(
+            fmt::format("  Using previously compiled model functions in {}.", libraryFile.string()));
+    }
+    else
+    {
+        if(!Utilities::writeStringToFile(sourceFile.string(), code))
+        {
+            env->output->outputWarning(" Could not write the generated code to " + sourceFile.string());
+            return (compiledFunctions);
+        }
+
+        // Compile to a temporary file first so that concurrent processes never load a partially written library
+        auto temporaryFile = cachePath / fmt::format("{}.{}.so", name, getpid());
+
+        std::string command = fmt::format("{} -O2 -shared -fPIC -o \"{}\" \"{}\" -lm",
+            env->settings->getSetting<std::string>("NonlinearExpressions.CompiledCode.Compiler", "Model"),
+            temporaryFile.string(), sourceFile.string());
+
+        env->output->outputDebug("  Compiling model functions: " + command);
+
+        if(std::system(command.c_str()) != 0)
+        {
+            env->output->outputWarning(" Could not compile the model functions with: " + command);
+            fs::filesystem::remove(temporaryFile, errorCode);
+            return (compiledFunctions);
+        }
+
+        fs::filesystem::rename(temporaryFile, libraryFile, errorCode);
+
+        if(errorCode)
+        {
+            env->output->outputWarning(" Could not move the compiled model functions to " + libraryFile.string());
+            fs::filesystem::remove(temporaryFile, errorCode);
+            return (compiledFunctions);
+        }
+    }
+
+    void* handle = dlopen(libraryFile.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if(handle == nullptr)
+    {
+        env->output->outputWarning(fmt::format(" Could not load the compiled model functions: {}", dlerror()));
+        return (compiledFunctions);
+    }
+
+    std::shared_ptr<void> library(handle, [](void* h) { dlclose(h); });
+
+    compiledFunctions.resize(functions.size());
+
+    for(size_t i = 0; i < functions.size(); i++)
+    {
+        auto& F = compiledFunctions[i];
+
+        F.valueFunction = reinterpret_cast<CompiledFunction::ValueFunction>(
+            dlsym(handle, fmt::format("shot_value_{}", i).c_str()));
+        F.gradientFunction = reinterpret_cast<CompiledFunction::GradientFunction>(
+            dlsym(handle, fmt::format("shot_gradient_{}", i).c_str()));
+
+        if(!F.isLoaded())
+        {
+            env->output->outputWarning(fmt::format(" Could not find compiled model function {}.", i));
+            compiledFunctions.clear();
+            return (compiledFunctions);
+        }
+
+        F.gradientVariables = functions[i].gradientVariables;
+        F.library = library;
+    }
+
+    return (compiledFunctions);
+#endif
+}
+
+ModelCodeGenerator::Operand ModelCodeGenerator::addNode(
+    Function& function, std::string value, std::vector<std::pair<Operand, std::string>> partials)
+{
+    Node node;
+    node.value = std::move(value);
+
+    for(auto& P : partials)
+    {
+        // Constants do not need any derivatives
+        if(P.first.node >= 0)
+            node.partialDerivatives.emplace_back(P.first.node, std::move(P.second));
+    }
+
+    function.nodes.push_back(std::move(node));
+
+    return (Operand{ (int)function.nodes.size() - 1 });
+}
+
+ModelCodeGenerator::Operand ModelCodeGenerator::addVariable(Function& function, const VariablePtr& variable)
+{
+    auto node = function.variableNodes.find(variable->index);
+
+    if(node != function.variableNodes.end())
+        return (Operand{ node->second });
+
+    auto operand = addNode(function, fmt::format("x[{}]", variable->index), {});
+    function.variableNodes.emplace(variable->index, operand.node);
+    function.gradientVariables.push_back(variable);
+
+    return (operand);
+}
+
+ModelCodeGenerator::Operand ModelCodeGenerator::addExpression(Function& function, const NonlinearExpression* expression)
+{
+    // Subexpressions that are shared in the expression are only calculated once
+    auto node = function.expressionNodes.find(expression);
+
+    if(node != function.expressionNodes.end())
+        return (node->second);
+
+    auto operand = addExpressionNode(function, expression);
+    function.expressionNodes.emplace(expression, operand);
+
+    return (operand);
+}
+
+ModelCodeGenerator::Operand ModelCodeGenerator::addExpressionNode(
+    Function& function, const NonlinearExpression* expression)
+{
+    auto type = expression->getType();
+
+    switch(type)
+    {
+    case(E_NonlinearExpressionTypes::Constant):
+        return (Operand{ -1, static_cast<const ExpressionConstant*>(expression)->constant });
+
+    case(E_NonlinearExpressionTypes::Variable):
+        return (addVariable(function, static_cast<const ExpressionVariable*>(expression)->variable));
+
+    case(E_NonlinearExpressionTypes::Sum):
+    {
+        auto general = static_cast<const ExpressionGeneral*>(expression);
+
+        if(general->children.size() == 0)
+            return (Operand{ -1, 0.0 });
+
+        std::vector<std::pair<Operand, std::string>> partials;
+        std::vector<std::string> values;
+
+        for(auto& C : general->children)
+        {
+            auto child = addExpression(function, C.get());
+            values.push_back(getString(child));
+            partials.emplace_back(child, "1.0");
+        }
+
+        return (addNode(function, fmt::format("{}", fmt::join(values, " + ")), partials));
+    }
+
+    case(E_NonlinearExpressionTypes::Product):
+    {
+        std::vector<Operand> factors;
+
+        for(auto& C : static_cast<const ExpressionGeneral*>(expression)->children)
+            factors.push_back(addExpression(function, C.get()));
+
+        return (addProduct(function, 1.0, factors));
+    }
+
+    case(E_NonlinearExpressionTypes::Divide):
+    case(E_NonlinearExpressionTypes::Power):
+    {
+        auto binary = static_cast<const ExpressionBinary*>(expression);
+        auto first = addExpression(function, binary->firstChild.get());
+        auto second = addExpression(function, binary->secondChild.get());
+
+        std::string a = getString(first);
+        std::string b = getString(second);
+        std::string self = fmt::format("v{}", function.nodes.size());
+
+        if(type == E_NonlinearExpressionTypes::Divide)
+            return (addNode(function, fmt::format("{} / {}", a, b),
+                { { first, fmt::format("1.0 / {}", b) }, { second, fmt::format("-{} / {}", self, b) } }));
+
+        return (addNode(function, fmt::format("shot_pow({}, {})", a, b),
+            { { first, fmt::format("{} * pow({}, {} - 1.0)", b, a, b) },
+                { second, fmt::format("{} * log({})", self, a) } }));
+    }
+
+    default:
+        break;
+    }
+
+    // The remaining expressions are unary
+    auto child = addExpression(function, static_cast<const ExpressionUnary*>(expression)->child.get());
+    std::string c = getString(child);
+    std::string self = fmt::format("v{}", function.nodes.size());
+
+    switch(type)
+    {
+    case(E_NonlinearExpressionTypes::Negate):
+        return (addNode(function, "-" + c, { { child, "-1.0" } }));
+
+    case(E_NonlinearExpressionTypes::Invert):
+        return (addNode(function, fmt::format("1.0 / {}", c), { { child, fmt::format("-{0} * {0}", self) } }));
+
+    case(E_NonlinearExpressionTypes::SquareRoot):
+        return (addNode(function, fmt::format("sqrt({})", c), { { child, fmt::format("0.5 / {}", self) } }));
+
+    case(E_NonlinearExpressionTypes::Log):
+        return (addNode(function, fmt::format("log({})", c), { { child, fmt::format("1.0 / {}", c) } }));
+
+    case(E_NonlinearExpressionTypes::Exp):
+        return (addNode(function, fmt::format("exp({})", c), { { child, self } }));
+
+    case(E_NonlinearExpressionTypes::Square):
+        return (addNode(function, fmt::format("{0} * {0}", c), { { child, fmt::format("2.0 * {}", c) } }));
+
+    case(E_NonlinearExpressionTypes::Cos):
+        return (addNode(function, fmt::format("cos({})", c), { { child, fmt::format("-sin({})", c) } }));
+
+    case(E_NonlinearExpressionTypes::Sin):
+        return (addNode(function, fmt::format("sin({})", c), { { child, fmt::format("cos({})", c) } }));
+
+    case(E_NonlinearExpressionTypes::Tan):
+        return (addNode(function, fmt::format("tan({})", c), { { child, fmt::format("1.0 + {0} * {0}", self) } }));
+
+    case(E_NonlinearExpressionTypes::ArcCos):
+        return (addNode(
+            function, fmt::format("acos({})", c), { { child, fmt::format("-1.0 / sqrt(1.0 - {0} * {0})", c) } }));
+
+    case(E_NonlinearExpressionTypes::ArcSin):
+        return (addNode(
+            function, fmt::format("asin({})", c), { { child, fmt::format("1.0 / sqrt(1.0 - {0} * {0})", c) } }));
+
+    case(E_NonlinearExpressionTypes::ArcTan):
+        return (addNode(
+            function, fmt::format("atan({})", c), { { child, fmt::format("1.0 / (1.0 + {0} * {0})", c) } }));
+
+    case(E_NonlinearExpressionTypes::Abs):
+        return (addNode(function, fmt::format("fabs({})", c),
+            { { child, fmt::format("(double)(({0} > 0.0) - ({0} < 0.0))", c) } }));
+
+    default:
+        throw std::logic_error("Unsupported nonlinear expression type in code generation");
+    }
+}
+
+ModelCodeGenerator::Operand ModelCodeGenerator::addProduct(
+    Function& function, double coefficient, const std::vector<Operand>& factors)
+{
+    if(factors.empty())
+        return (Operand{ -1, coefficient });
+
+    std::vector<std::string> values;
+
+    if(coefficient != 1.0)
+        values.push_back(getString(Operand{ -1, coefficient }));
+
+    for(auto& F : factors)
+        values.push_back(getString(F));
+
+    std::vector<std::pair<Operand, std::string>> partials;
+    size_t offset = (coefficient != 1.0) ? 1 : 0;
+
+    // The partial derivative with respect to a factor is the product of the other factors
+    for(size_t i = 0; i < factors.size(); i++)
+    {
+        std::vector<std::string> otherValues;
+
+        for(size_t j = 0; j < values.size(); j++)
+        {
+            if(j != i + offset)
+                otherValues.push_back(values[j]);
+        }
+
+        partials.emplace_back(
+            factors[i], otherValues.empty() ? std::string("1.0") : fmt::format("{}", fmt::join(otherValues, " * ")));
+    }
+
+    return (addNode(function, fmt::format("{}", fmt::join(values, " * ")), partials));
+}
+
+std::string ModelCodeGenerator::getString(const Operand& operand) const
+{
+    if(operand.node >= 0)
+        return (fmt::format("v{}", operand.node));
+
+    if(std::isnan(operand.constant))
+        return ("NAN");
+
+    if(std::isinf(operand.constant))
+        return (operand.constant > 0 ? "HUGE_VAL" : "(-HUGE_VAL)");
+
+    // Always written as a floating point literal, so that e.g. divisions between constants are not integer divisions
+    std::string value = fmt::format("{:.17g}", operand.constant);
+
+    if(value.find_first_of(".e") == std::string::npos)
+        value += ".0";
+
+    if(operand.constant < 0)
+        return ("(" + value + ")");
+
+    return (value);
+}
+
+void ModelCodeGenerator::generateCode(
+    Function& function, const std::vector<Operand>& terms, double constant, int index)
+{
+    Operand root;
+
+    if(constant == 0.0 && terms.size() == 1)
+    {
+        root = terms[0];
+    }
+    else
+    {
+        std::vector<std::string> values;
+        std::vector<std::pair<Operand, std::string>> partials;
+
+        for(auto& T : terms)
+        {
+            values.push_back(getString(T));
+            partials.emplace_back(T, "1.0");
+        }
+
+        if(constant != 0.0 || values.empty())
+            values.push_back(getString(Operand{ -1, constant }));
+
+        root = addNode(function, fmt::format("{}", fmt::join(values, " + ")), partials);
+    }
+
+    // The partial derivatives are written in the order of the variable indexes
+    std::sort(function.gradientVariables.begin(), function.gradientVariables.end(),
+        [](const VariablePtr& first, const VariablePtr& second) { return (first->index < second->index); });
+
+    std::stringstream forward;
+
+    for(size_t i = 0; i < function.nodes.size(); i++)
+        forward << fmt::format("    const double v{} = {};\n", i, function.nodes[i].value);
+
+    std::stringstream code;
+
+    code << fmt::format("\ndouble shot_value_{}(const double* x)\n{{\n", index);
+    code << forward.str();
+    code << fmt::format("    return {};\n}}\n", getString(root));
+
+    code << fmt::format("\ndouble shot_gradient_{}(const double* x, double* g)\n{{\n", index);
+    code << forward.str();
+
+    // Reverse sweep, the adjoint of each node is the derivative of the function with respect to it
+    for(size_t i = 0; i < function.nodes.size(); i++)
+        code << fmt::format("    double a{} = {};\n", i, (int)i == root.node ? "1.0" : "0.0");
+
+    for(int i = (int)function.nodes.size() - 1; i >= 0; i--)
+    {
+        for(auto& P : function.nodes[i].partialDerivatives)
+            code << fmt::format("    a{} += a{} * ({});\n", P.first, i, P.second);
+    }
+
+    for(size_t i = 0; i < function.gradientVariables.size(); i++)
+        code << fmt::format("    g[{}] = a{};\n", i, function.variableNodes[function.gradientVariables[i]->index]);
+
+    code << fmt::format("    return {};\n}}\n", getString(root));
+
+    function.code = code.str();
+}
+} // namespace SHOT
@@ -0,0 +1,115 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include "../Environment.h"
+#include "../Structs.h"
+
+#include "Variables.h"
+#include "Terms.h"
+#include "NonlinearExpressions.h"
+
+#include <memory>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SHOT
+{
+
+// A function (including all its terms) that has been generated as C code, compiled to a shared library and loaded
+struct CompiledFunction
+{
+    using ValueFunction = double (*)(const double*);
+    using GradientFunction = double (*)(const double*, double*);
+
+    ValueFunction valueFunction = nullptr;
+    GradientFunction gradientFunction = nullptr;
+
+    // The variables in the gradient, ordered by index
+    Variables gradientVariables;
+
+    // Keeps the shared library loaded as long as the function is in use
+    std::shared_ptr<void> library;
+
+    inline bool isLoaded() const { return (valueFunction != nullptr && gradientFunction != nullptr); }
+
+    inline double calculateValue(const VectorDouble& point) const { return (valueFunction(point.data())); }
+
+    // Returns the value of the function, the partial derivatives are written to gradient in the order given by
+    // gradientVariables
+    inline double calculateGradient(const VectorDouble& point, double* gradient) const
+    {
+        return (gradientFunction(point.data(), gradient));
+    }
+
+    SparseVariableVector calculateGradient(const VectorDouble& point, bool eraseZeroes) const;
+
+    void clear();
+};
+
+// Generates straight-line C code for the values and gradients of functions, and compiles and loads the code with the
+// system compiler
+class ModelCodeGenerator
+{
+public:
+    ModelCodeGenerator(EnvironmentPtr envPtr) : env(envPtr) {};
+
+    // Adds a function with the given terms, returns its index in the generated library
+    int add(const LinearTerms& linearTerms, const QuadraticTerms& quadraticTerms, const MonomialTerms& monomialTerms,
+        const SignomialTerms& signomialTerms, const NonlinearExpressionPtr& nonlinearExpression, double constant);
+
+    inline size_t size() const { return (functions.size()); }
+
+    std::string getCode() const;
+
+    // Compiles the code (or reuses a previously compiled library with the same code) and loads it. The functions are
+    // returned in the order they were added, or an empty vector if the code could not be compiled or loaded
+    std::vector<CompiledFunction> compile();
+
+private:
+    struct Operand
+    {
+        int node = -1; // The index of the node, or -1 for a constant
+        double constant = 0.0;
+    };
+
+    struct Node
+    {
+        std::string value;
+        // The local derivatives with respect to the operand nodes
+        std::vector<std::pair<int, std::string>> partialDerivatives;
+    };
+
+    struct Function
+    {
+        std::vector<Node> nodes;
+        std::map<int, int> variableNodes; // The node for each variable index
+        std::map<const NonlinearExpression*, Operand> expressionNodes; // For expressions shared in the function
+        Variables gradientVariables;
+        std::string code;
+    };
+
+    Operand addNode(Function& function, std::string value, std::vector<std::pair<Operand, std::string>> partials);
+    Operand addVariable(Function& function, const VariablePtr& variable);
+    Operand addExpression(Function& function, const NonlinearExpression* expression);
+    Operand addExpressionNode(Function& function, const NonlinearExpression* expression);
+    Operand addProduct(Function& function, double coefficient, const std::vector<Operand>& factors);
+
+    std::string getString(const Operand& operand) const;
+
+    void generateCode(Function& function, const std::vector<Operand>& terms, double constant, int index);
+
+    std::vector<Function> functions;
+
+    EnvironmentPtr env;
+};
+} // namespace SHOT
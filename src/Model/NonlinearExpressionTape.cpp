@@ -0,0 +1,698 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "NonlinearExpressionTape.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SHOT
+{
+
+void NonlinearExpressionTape::compile(const NonlinearExpressionPtr& expression)
+{
+    clear();
+
+    if(!expression)
+        return;
+
+    append(expression.get());
+
+    sourceExpression = expression;
+}
+
+void NonlinearExpressionTape::clear()
+{
+    instructions.clear();
+    sourceExpression.reset();
+    stackSize = 0;
+    currentStackSize = 0;
+}
+
+void NonlinearExpressionTape::append(const NonlinearExpression* expression)
+{
+    NonlinearExpressionTapeInstruction instruction;
+    instruction.type = expression->getType();
+
+    switch(instruction.type)
+    {
+    case(E_NonlinearExpressionTypes::Constant):
+        instruction.constant = static_cast<const ExpressionConstant*>(expression)->constant;
+        currentStackSize++;
+        break;
+
+    case(E_NonlinearExpressionTypes::Variable):
+        instruction.argument = static_cast<const ExpressionVariable*>(expression)->variable->index;
+        currentStackSize++;
+        break;
+
+    case(E_NonlinearExpressionTypes::Negate):
+    case(E_NonlinearExpressionTypes::Invert):
+    case(E_NonlinearExpressionTypes::SquareRoot):
+    case(E_NonlinearExpressionTypes::Log):
+    case(E_NonlinearExpressionTypes::Exp):
+    case(E_NonlinearExpressionTypes::Square):
+    case(E_NonlinearExpressionTypes::Cos):
+    case(E_NonlinearExpressionTypes::Sin):
+    case(E_NonlinearExpressionTypes::Tan):
+    case(E_NonlinearExpressionTypes::ArcCos):
+    case(E_NonlinearExpressionTypes::ArcSin):
+    case(E_NonlinearExpressionTypes::ArcTan):
+    case(E_NonlinearExpressionTypes::Abs):
+        append(static_cast<const ExpressionUnary*>(expression)->child.get());
+        break;
+
+    case(E_NonlinearExpressionTypes::Divide):
+    case(E_NonlinearExpressionTypes::Power):
+        append(static_cast<const ExpressionBinary*>(expression)->firstChild.get());
+        append(static_cast<const ExpressionBinary*>(expression)->secondChild.get());
+        currentStackSize--;
+        break;
+
+    case(E_NonlinearExpressionTypes::Sum):
+    case(E_NonlinearExpressionTypes::Product):
+    {
+        auto general = static_cast<const ExpressionGeneral*>(expression);
+
+        for(auto& C : general->children)
+            append(C.get());
+
+        instruction.argument = general->children.size();
+
+        if(instruction.argument == 0)
+            currentStackSize++;
+        else
+            currentStackSize -= instruction.argument - 1;
+
+        break;
+    }
+    }
+
+    stackSize = std::max(stackSize, currentStackSize);
+    instructions.push_back(instruction);
+}
+
+double NonlinearExpressionTape::calculate(const VectorDouble& point) const
+{
+    // Each thread has its own evaluation stack so that the tape can be evaluated concurrently
+    thread_local std::vector<double> stack;
+
+    if(stack.size() < stackSize)
+        stack.resize(stackSize);
+
+    double* values = stack.data();
+    size_t top = 0; // The number of values on the stack
+
+    for(auto& I : instructions)
+    {
+        switch(I.type)
+        {
+        case(E_NonlinearExpressionTypes::Constant):
+            values[top++] = I.constant;
+            break;
+
+        case(E_NonlinearExpressionTypes::Variable):
+            values[top++] = point[I.argument];
+            break;
+
+        case(E_NonlinearExpressionTypes::Negate):
+            values[top - 1] = -values[top - 1];
+            break;
+
+        case(E_NonlinearExpressionTypes::Invert):
+            values[top - 1] = 1.0 / values[top - 1];
+            break;
+
+        case(E_NonlinearExpressionTypes::SquareRoot):
+            values[top - 1] = sqrt(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Log):
+            values[top - 1] = log(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Exp):
+            values[top - 1] = exp(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Square):
+            values[top - 1] = values[top - 1] * values[top - 1];
+            break;
+
+        case(E_NonlinearExpressionTypes::Cos):
+            values[top - 1] = cos(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Sin):
+            values[top - 1] = sin(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Tan):
+            values[top - 1] = tan(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::ArcCos):
+            values[top - 1] = acos(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::ArcSin):
+            values[top - 1] = asin(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::ArcTan):
+            values[top - 1] = atan(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Abs):
+            values[top - 1] = std::abs(values[top - 1]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Divide):
+            top--;
+            values[top - 1] = values[top - 1] / values[top];
+            break;
+
+        case(E_NonlinearExpressionTypes::Power):
+        {
+            top--;
+            double base = values[top - 1];
+            double exponent = values[top];
+
+            // Same special cases as in ExpressionPower::calculate
+            if(std::abs(base - 0.0) <= 1e-10 * std::abs(base))
+                values[top - 1] = 0.0;
+            else if(std::abs(base - 1.0) <= 1e-10 * std::abs(base))
+                values[top - 1] = 1.0;
+            else if(std::abs(exponent - 0.0) <= 1e-10 * std::abs(base))
+                values[top - 1] = 1.0;
+            else if(std::abs(exponent - 1.0) <= 1e-10 * std::abs(base))
+                values[top - 1] = base;
+            else
+                values[top - 1] = pow(base, exponent);
+
+            break;
+        }
+
+        case(E_NonlinearExpressionTypes::Sum):
+        {
+            top -= I.argument;
+            double value = 0.0;
+
+            for(int i = 0; i < I.argument; i++)
+                value += values[top + i];
+
+            values[top++] = value;
+            break;
+        }
+
+        case(E_NonlinearExpressionTypes::Product):
+        {
+            top -= I.argument;
+            double value = 1.0;
+
+            for(int i = 0; i < I.argument; i++)
+            {
+                if(values[top + i] == 0.0)
+                {
+                    value = 0.0;
+                    break;
+                }
+
+                value = value * values[top + i];
+            }
+
+            values[top++] = value;
+            break;
+        }
+        }
+    }
+
+    return (values[0]);
+}
+
+double NonlinearExpressionTape::calculate(
+    const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative) const
+{
+    // The values and the derivatives along the direction (tangents) are propagated together in a forward sweep
+    thread_local std::vector<double> valueStack;
+    thread_local std::vector<double> tangentStack;
+
+    if(valueStack.size() < stackSize)
+    {
+        valueStack.resize(stackSize);
+        tangentStack.resize(stackSize);
+    }
+
+    double* values = valueStack.data();
+    double* tangents = tangentStack.data();
+    size_t top = 0; // The number of values on the stack
+
+    for(auto& I : instructions)
+    {
+        size_t last = top - 1; // The top of the stack for the unary operations
+
+        switch(I.type)
+        {
+        case(E_NonlinearExpressionTypes::Constant):
+            values[top] = I.constant;
+            tangents[top++] = 0.0;
+            break;
+
+        case(E_NonlinearExpressionTypes::Variable):
+            values[top] = point[I.argument];
+            tangents[top++] = direction[I.argument];
+            break;
+
+        case(E_NonlinearExpressionTypes::Negate):
+            values[last] = -values[last];
+            tangents[last] = -tangents[last];
+            break;
+
+        case(E_NonlinearExpressionTypes::Invert):
+            values[last] = 1.0 / values[last];
+            tangents[last] = -tangents[last] * values[last] * values[last];
+            break;
+
+        case(E_NonlinearExpressionTypes::SquareRoot):
+            values[last] = sqrt(values[last]);
+            tangents[last] = tangents[last] / (2.0 * values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Log):
+            tangents[last] = tangents[last] / values[last];
+            values[last] = log(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Exp):
+            values[last] = exp(values[last]);
+            tangents[last] = tangents[last] * values[last];
+            break;
+
+        case(E_NonlinearExpressionTypes::Square):
+            tangents[last] = 2.0 * values[last] * tangents[last];
+            values[last] = values[last] * values[last];
+            break;
+
+        case(E_NonlinearExpressionTypes::Cos):
+            tangents[last] = -sin(values[last]) * tangents[last];
+            values[last] = cos(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Sin):
+            tangents[last] = cos(values[last]) * tangents[last];
+            values[last] = sin(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Tan):
+            values[last] = tan(values[last]);
+            tangents[last] = (1.0 + values[last] * values[last]) * tangents[last];
+            break;
+
+        case(E_NonlinearExpressionTypes::ArcCos):
+            tangents[last] = -tangents[last] / sqrt(1.0 - values[last] * values[last]);
+            values[last] = acos(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::ArcSin):
+            tangents[last] = tangents[last] / sqrt(1.0 - values[last] * values[last]);
+            values[last] = asin(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::ArcTan):
+            tangents[last] = tangents[last] / (1.0 + values[last] * values[last]);
+            values[last] = atan(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Abs):
+            tangents[last] = (values[last] > 0.0) ? tangents[last] : ((values[last] < 0.0) ? -tangents[last] : 0.0);
+            values[last] = std::abs(values[last]);
+            break;
+
+        case(E_NonlinearExpressionTypes::Divide):
+        {
+            top--;
+            double denominator = values[top];
+            values[top - 1] = values[top - 1] / denominator;
+            tangents[top - 1] = (tangents[top - 1] - values[top - 1] * tangents[top]) / denominator;
+            break;
+        }
+
+        case(E_NonlinearExpressionTypes::Power):
+        {
+            top--;
+            double base = values[top - 1];
+            double exponent = values[top];
+            double baseTangent = tangents[top - 1];
+            double exponentTangent = tangents[top];
+
+            double result;
+
+            // Same special cases as in ExpressionPower::calculate
+            if(std::abs(base - 0.0) <= 1e-10 * std::abs(base))
+                result = 0.0;
+            else if(std::abs(base - 1.0) <= 1e-10 * std::abs(base))
+                result = 1.0;
+            else if(std::abs(exponent - 0.0) <= 1e-10 * std::abs(base))
+                result = 1.0;
+            else if(std::abs(exponent - 1.0) <= 1e-10 * std::abs(base))
+                result = base;
+            else
+                result = pow(base, exponent);
+
+            double resultTangent = 0.0;
+
+            if(baseTangent != 0.0)
+                resultTangent += exponent * pow(base, exponent - 1.0) * baseTangent;
+
+            if(exponentTangent != 0.0)
+                resultTangent += result * log(base) * exponentTangent;
+
+            values[top - 1] = result;
+            tangents[top - 1] = resultTangent;
+            break;
+        }
+
+        case(E_NonlinearExpressionTypes::Sum):
+        {
+            top -= I.argument;
+            double sumValue = 0.0;
+            double sumTangent = 0.0;
+
+            for(int i = 0; i < I.argument; i++)
+            {
+                sumValue += values[top + i];
+                sumTangent += tangents[top + i];
+            }
+
+            values[top] = sumValue;
+            tangents[top++] = sumTangent;
+            break;
+        }
+
+        case(E_NonlinearExpressionTypes::Product):
+        {
+            top -= I.argument;
+            double productValue = 1.0;
+            double productTangent = 0.0;
+            bool hasZeroFactor = false;
+
+            for(int i = 0; i < I.argument; i++)
+            {
+                productTangent = productTangent * values[top + i] + productValue * tangents[top + i];
+                productValue = productValue * values[top + i];
+
+                if(values[top + i] == 0.0)
+                    hasZeroFactor = true;
+            }
+
+            values[top] = hasZeroFactor ? 0.0 : productValue;
+            tangents[top++] = productTangent;
+            break;
+        }
+        }
+    }
+
+    directionalDerivative = tangents[0];
+    return (values[0]);
+}
+
+void NonlinearExpressionTape::calculate(const double* points, size_t numberOfPoints, double* values) const
+{
+    // The points are evaluated in batches, so that each stack slot holds the values for all points in the batch and
+    // the inner loops run over consecutive memory
+    constexpr size_t batchWidth = 64;
+
+    thread_local std::vector<double> stack;
+
+    if(stack.size() < stackSize * batchWidth)
+        stack.resize(stackSize * batchWidth);
+
+    for(size_t first = 0; first < numberOfPoints; first += batchWidth)
+    {
+        size_t width = std::min(batchWidth, numberOfPoints - first);
+        double* slots = stack.data();
+        size_t top = 0; // The number of slots on the stack
+
+        for(auto& I : instructions)
+        {
+            switch(I.type)
+            {
+            case(E_NonlinearExpressionTypes::Constant):
+            {
+                double* result = slots + batchWidth * top++;
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = I.constant;
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Variable):
+            {
+                double* result = slots + batchWidth * top++;
+                const double* variableValues = points + I.argument * numberOfPoints + first;
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = variableValues[i];
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Negate):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = -result[i];
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Invert):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = 1.0 / result[i];
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::SquareRoot):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = sqrt(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Log):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = log(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Exp):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = exp(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Square):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = result[i] * result[i];
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Cos):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = cos(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Sin):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = sin(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Tan):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = tan(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::ArcCos):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = acos(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::ArcSin):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = asin(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::ArcTan):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = atan(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Abs):
+            {
+                double* result = slots + batchWidth * (top - 1);
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = std::abs(result[i]);
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Divide):
+            {
+                top--;
+                double* result = slots + batchWidth * (top - 1);
+                const double* divisors = slots + batchWidth * top;
+
+                for(size_t i = 0; i < width; i++)
+                    result[i] = result[i] / divisors[i];
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Power):
+            {
+                top--;
+                double* result = slots + batchWidth * (top - 1);
+                const double* exponents = slots + batchWidth * top;
+
+                for(size_t i = 0; i < width; i++)
+                {
+                    double base = result[i];
+                    double exponent = exponents[i];
+
+                    // Same special cases as in ExpressionPower::calculate
+                    if(std::abs(base - 0.0) <= 1e-10 * std::abs(base))
+                        result[i] = 0.0;
+                    else if(std::abs(base - 1.0) <= 1e-10 * std::abs(base))
+                        result[i] = 1.0;
+                    else if(std::abs(exponent - 0.0) <= 1e-10 * std::abs(base))
+                        result[i] = 1.0;
+                    else if(std::abs(exponent - 1.0) <= 1e-10 * std::abs(base))
+                        result[i] = base;
+                    else
+                        result[i] = pow(base, exponent);
+                }
+
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Sum):
+            {
+                if(I.argument == 0)
+                {
+                    double* result = slots + batchWidth * top++;
+
+                    for(size_t i = 0; i < width; i++)
+                        result[i] = 0.0;
+
+                    break;
+                }
+
+                top -= I.argument;
+                double* result = slots + batchWidth * top;
+
+                for(int k = 1; k < I.argument; k++)
+                {
+                    const double* operand = result + batchWidth * k;
+
+                    for(size_t i = 0; i < width; i++)
+                        result[i] += operand[i];
+                }
+
+                top++;
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Product):
+            {
+                if(I.argument == 0)
+                {
+                    double* result = slots + batchWidth * top++;
+
+                    for(size_t i = 0; i < width; i++)
+                        result[i] = 1.0;
+
+                    break;
+                }
+
+                top -= I.argument;
+                double* result = slots + batchWidth * top;
+
+                // A zero factor gives zero even if another factor is infinite, as in ExpressionProduct::calculate
+                for(int k = 1; k < I.argument; k++)
+                {
+                    const double* operand = result + batchWidth * k;
+
+                    for(size_t i = 0; i < width; i++)
+                        result[i] = (result[i] == 0.0 || operand[i] == 0.0) ? 0.0 : result[i] * operand[i];
+                }
+
+                top++;
+                break;
+            }
+            }
+        }
+
+        for(size_t i = 0; i < width; i++)
+            values[first + i] += slots[i];
+    }
+}
+} // namespace SHOT
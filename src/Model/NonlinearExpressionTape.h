@@ -0,0 +1,64 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include "../Structs.h"
+#include "NonlinearExpressions.h"
+
+#include <vector>
+
+namespace SHOT
+{
+
+struct NonlinearExpressionTapeInstruction
+{
+    E_NonlinearExpressionTypes type;
+    int argument = 0; // The variable index for variables, the number of operands for sums and products
+    double constant = 0.0;
+};
+
+// A nonlinear expression tree compiled into a postfix instruction stream, that can be evaluated in a single loop
+// without virtual calls
+class NonlinearExpressionTape
+{
+public:
+    NonlinearExpressionTape() = default;
+
+    void compile(const NonlinearExpressionPtr& expression);
+    void clear();
+
+    // Whether the tape has been compiled from the given expression, i.e. whether it can be used instead of it
+    inline bool isCompiledFrom(const NonlinearExpressionPtr& expression) const
+    {
+        return (expression && sourceExpression == expression);
+    }
+
+    double calculate(const VectorDouble& point) const;
+
+    // Also calculates the derivative of the expression along the direction, i.e. the gradient times the direction
+    double calculate(const VectorDouble& point, const VectorDouble& direction, double& directionalDerivative) const;
+
+    // Adds the value of the expression in each of the points to values. The points are given as a column-major block,
+    // i.e. the value of the variable with index j in point i is points[j * numberOfPoints + i]
+    void calculate(const double* points, size_t numberOfPoints, double* values) const;
+
+    inline size_t size() const { return (instructions.size()); }
+
+private:
+    void append(const NonlinearExpression* expression);
+
+    std::vector<NonlinearExpressionTapeInstruction> instructions;
+    NonlinearExpressionPtr sourceExpression;
+
+    size_t stackSize = 0;
+    size_t currentStackSize = 0;
+};
+} // namespace SHOT
@@ -14,12 +14,15 @@
 #pragma once
 #include "../Enums.h"
 #include "Variables.h"
+#include "ExpressionArena.h"
 
 #include "../Utilities.h"
 
 #include "ffunc.hpp"
 #include "cppad/cppad.hpp"
 
+#include <unordered_map>
+
 namespace SHOT
 {
 
@@ -122,17 +125,17 @@ inline E_Monotonicity getMonotonicityTimesWithConstantFunction(
 class NonlinearExpression
 {
 public:
-    std::weak_ptr<Problem> ownerProblem;
-
-    virtual inline void takeOwnership(ProblemPtr owner) { ownerProblem = owner; }
-
     virtual double calculate([[maybe_unused]] const VectorDouble& point) const = 0;
     virtual Interval calculate([[maybe_unused]] const IntervalVector& intervalVector) const = 0;
     virtual Interval getBounds() const = 0;
 
     virtual bool tightenBounds(Interval bound) = 0;
 
-    virtual FactorableFunction getFactorableFunction() = 0;
+    // Returns the expression recorded on the current CppAD tape. While a FactorableFunctionCache exists, each node is
+    // only recorded once even if it is shared by several expressions.
+    inline FactorableFunction getFactorableFunction();
+
+    virtual FactorableFunction createFactorableFunction() = 0;
 
     virtual std::ostream& print(std::ostream&) const = 0;
 
@@ -155,6 +158,43 @@ public:
 
 using NonlinearExpressionPtr = std::shared_ptr<NonlinearExpression>;
 
+// The expression nodes recorded on the CppAD tape, so that nodes shared between expressions are only recorded once
+class FactorableFunctionCache
+{
+public:
+    FactorableFunctionCache() : previous(current) { current = this; }
+    ~FactorableFunctionCache() { current = previous; }
+
+    FactorableFunctionCache(const FactorableFunctionCache&) = delete;
+    FactorableFunctionCache& operator=(const FactorableFunctionCache&) = delete;
+
+    // The cache used in the current thread, if any
+    static inline thread_local FactorableFunctionCache* current = nullptr;
+
+    std::unordered_map<const NonlinearExpression*, FactorableFunction> functions;
+
+private:
+    FactorableFunctionCache* previous;
+};
+
+inline FactorableFunction NonlinearExpression::getFactorableFunction()
+{
+    auto cache = FactorableFunctionCache::current;
+
+    if(cache == nullptr)
+        return (createFactorableFunction());
+
+    auto element = cache->functions.find(this);
+
+    if(element != cache->functions.end())
+        return (element->second);
+
+    auto function = createFactorableFunction();
+    cache->functions.emplace(this, function);
+
+    return (function);
+}
+
 inline std::ostream& operator<<(std::ostream& stream, NonlinearExpressionPtr expr)
 {
     if(expr != nullptr)
@@ -207,7 +247,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return false; };
 
-    inline FactorableFunction getFactorableFunction() override { return constant; };
+    inline FactorableFunction createFactorableFunction() override { return constant; };
 
     inline std::ostream& print(std::ostream& stream) const override { return stream << constant; };
 
@@ -243,7 +283,7 @@ public:
         return (variable->calculate(intervalVector));
     };
 
-    inline FactorableFunction getFactorableFunction() override { return *(variable->factorableFunctionVariable); };
+    inline FactorableFunction createFactorableFunction() override { return *(variable->factorableFunctionVariable); };
 
     inline Interval getBounds() const override { return (variable->getBound()); };
 
@@ -280,15 +320,9 @@ class ExpressionUnary : public NonlinearExpression
 public:
     NonlinearExpressionPtr child;
 
-    inline void takeOwnership(ProblemPtr owner) override
-    {
-        ownerProblem = owner;
-        child->takeOwnership(owner);
-    }
-
     double calculate(const VectorDouble& point) const override = 0;
     Interval calculate(const IntervalVector& intervalVector) const override = 0;
-    FactorableFunction getFactorableFunction() override = 0;
+    FactorableFunction createFactorableFunction() override = 0;
     E_NonlinearExpressionTypes getType() const override = 0;
 
     inline int getNumberOfChildren() const override { return 1; }
@@ -306,16 +340,9 @@ public:
     NonlinearExpressionPtr firstChild;
     NonlinearExpressionPtr secondChild;
 
-    inline void takeOwnership(ProblemPtr owner) override
-    {
-        ownerProblem = owner;
-        firstChild->takeOwnership(owner);
-        secondChild->takeOwnership(owner);
-    }
-
     double calculate(const VectorDouble& point) const override = 0;
     Interval calculate(const IntervalVector& intervalVector) const override = 0;
-    FactorableFunction getFactorableFunction() override = 0;
+    FactorableFunction createFactorableFunction() override = 0;
     E_NonlinearExpressionTypes getType() const override = 0;
 
     inline int getNumberOfChildren() const override { return 2; }
@@ -332,17 +359,9 @@ class ExpressionGeneral : public NonlinearExpression
 public:
     NonlinearExpressions children;
 
-    inline void takeOwnership(ProblemPtr owner) override
-    {
-        ownerProblem = owner;
-
-        for(auto& C : children)
-            C->takeOwnership(owner);
-    }
-
     double calculate(const VectorDouble& point) const override = 0;
     Interval calculate(const IntervalVector& intervalVector) const override = 0;
-    FactorableFunction getFactorableFunction() override = 0;
+    FactorableFunction createFactorableFunction() override = 0;
     E_NonlinearExpressionTypes getType() const override = 0;
 
     inline int getNumberOfChildren() const override { return children.size(); }
@@ -374,7 +393,7 @@ public:
 
     inline bool tightenBounds(Interval bound) override { return (child->tightenBounds(-bound)); };
 
-    inline FactorableFunction getFactorableFunction() override { return (-child->getFactorableFunction()); }
+    inline FactorableFunction createFactorableFunction() override { return (-child->getFactorableFunction()); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -468,7 +487,7 @@ public:
         return (child->tightenBounds(1.0 / bound));
     };
 
-    inline FactorableFunction getFactorableFunction() override { return (1 / child->getFactorableFunction()); }
+    inline FactorableFunction createFactorableFunction() override { return (1 / child->getFactorableFunction()); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -561,7 +580,7 @@ public:
         return (child->tightenBounds(interval));
     };
 
-    inline FactorableFunction getFactorableFunction() override { return (sqrt(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (sqrt(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -666,7 +685,7 @@ public:
         return (child->tightenBounds(exp(bound)));
     };
 
-    inline FactorableFunction getFactorableFunction() override { return (log(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (log(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -726,7 +745,7 @@ public:
         return (child->tightenBounds(log(bound)));
     };
 
-    inline FactorableFunction getFactorableFunction() override { return (exp(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (exp(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -800,7 +819,7 @@ public:
         return (child->tightenBounds(sqrt(bound)));
     };
 
-    inline FactorableFunction getFactorableFunction() override
+    inline FactorableFunction createFactorableFunction() override
     {
         return (child->getFactorableFunction() * child->getFactorableFunction());
     }
@@ -877,7 +896,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (sin(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (sin(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -977,7 +996,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (cos(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (cos(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -1077,7 +1096,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (tan(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (tan(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -1144,7 +1163,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (asin(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (asin(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -1201,7 +1220,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (acos(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (acos(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -1259,7 +1278,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (atan(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (atan(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -1316,7 +1335,7 @@ public:
 
     inline bool tightenBounds([[maybe_unused]] Interval bound) override { return (false); };
 
-    inline FactorableFunction getFactorableFunction() override { return (fabs(child->getFactorableFunction())); }
+    inline FactorableFunction createFactorableFunction() override { return (fabs(child->getFactorableFunction())); }
 
     inline std::ostream& print(std::ostream& stream) const override
     {
@@ -1422,7 +1441,7 @@ public:
         return (false);
     }
 
-    inline FactorableFunction getFactorableFunction() override
+    inline FactorableFunction createFactorableFunction() override
     {
         return (firstChild->getFactorableFunction() / secondChild->getFactorableFunction());
     }
@@ -1664,7 +1683,7 @@ public:
         if(rhs.getType() != getType())
             return (false);
 
-        auto expression = dynamic_cast<const ExpressionDivide&>(rhs);
+        auto& expression = dynamic_cast<const ExpressionDivide&>(rhs);
 
         return (expression.firstChild.get() == firstChild.get() && expression.secondChild.get() == secondChild.get());
     };
@@ -1845,7 +1864,7 @@ public:
         return (firstChild->tightenBounds(interval));
     };
 
-    inline FactorableFunction getFactorableFunction() override
+    inline FactorableFunction createFactorableFunction() override
     {
         // Special logic for integer powers
         if(secondChild->getType() == E_NonlinearExpressionTypes::Constant)
@@ -1936,7 +1955,7 @@ public:
         if(rhs.getType() != getType())
             return (false);
 
-        auto expression = dynamic_cast<const ExpressionPower&>(rhs);
+        auto& expression = dynamic_cast<const ExpressionPower&>(rhs);
 
         return (expression.firstChild.get() == firstChild.get() && expression.secondChild.get() == secondChild.get());
     };
@@ -2226,7 +2245,7 @@ public:
         return (tightened);
     };
 
-    inline FactorableFunction getFactorableFunction() override
+    inline FactorableFunction createFactorableFunction() override
     {
         FactorableFunction funct;
 
@@ -2328,7 +2347,7 @@ public:
         if(rhs.getNumberOfChildren() != getNumberOfChildren())
             return false;
 
-        auto expression = dynamic_cast<const ExpressionSum&>(rhs);
+        auto& expression = dynamic_cast<const ExpressionSum&>(rhs);
 
         for(int i = 0; i < getNumberOfChildren(); i++)
         {
@@ -2433,7 +2452,7 @@ public:
         return (tightened);
     };
 
-    inline FactorableFunction getFactorableFunction() override
+    inline FactorableFunction createFactorableFunction() override
     {
         FactorableFunction funct;
 
@@ -2656,7 +2675,7 @@ public:
         if(rhs.getNumberOfChildren() != getNumberOfChildren())
             return false;
 
-        auto expression = dynamic_cast<const ExpressionProduct&>(rhs);
+        auto& expression = dynamic_cast<const ExpressionProduct&>(rhs);
 
         for(int i = 0; i < getNumberOfChildren(); i++)
         {
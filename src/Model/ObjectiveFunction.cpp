@@ -574,7 +574,7 @@ void NonlinearObjectiveFunction::add(NonlinearExpressionPtr expression)
         NonlinearExpressions terms;
         terms.push_back(nonlinearExpression);
         terms.push_back(expression);
-        nonlinearExpression = std::make_shared<ExpressionSum>(std::move(terms));
+        nonlinearExpression = makeExpression<ExpressionSum>(std::move(terms));
     }
     else
     {
@@ -589,6 +589,14 @@ void NonlinearObjectiveFunction::updateFactorableFunction()
     factorableFunction = std::make_shared<FactorableFunction>(nonlinearExpression->getFactorableFunction());
 }
 
+void NonlinearObjectiveFunction::updateNonlinearExpressionTape()
+{
+    if(properties.hasNonlinearExpression)
+        nonlinearExpressionTape.compile(nonlinearExpression);
+    else
+        nonlinearExpressionTape.clear();
+}
+
 void NonlinearObjectiveFunction::updateProperties()
 {
     QuadraticObjectiveFunction::updateProperties();
@@ -671,18 +679,24 @@ void NonlinearObjectiveFunction::takeOwnership(ProblemPtr owner)
     QuadraticObjectiveFunction::takeOwnership(owner);
     monomialTerms.takeOwnership(owner);
     signomialTerms.takeOwnership(owner);
-    if(nonlinearExpression != nullptr)
-        nonlinearExpression->takeOwnership(owner);
 }
 
 double NonlinearObjectiveFunction::calculateValue(const VectorDouble& point)
 {
+    if(compiledFunction.isLoaded())
+        return (compiledFunction.calculateValue(point));
+
     double value = QuadraticObjectiveFunction::calculateValue(point);
     value += monomialTerms.calculate(point);
     value += signomialTerms.calculate(point);
 
     if(this->properties.hasNonlinearExpression)
-        value += nonlinearExpression->calculate(point);
+    {
+        if(nonlinearExpressionTape.isCompiledFrom(nonlinearExpression))
+            value += nonlinearExpressionTape.calculate(point);
+        else
+            value += nonlinearExpression->calculate(point);
+    }
 
     return value;
 }
@@ -708,6 +722,9 @@ Interval NonlinearObjectiveFunction::calculateValue(const IntervalVector& interv
 
 SparseVariableVector NonlinearObjectiveFunction::calculateGradient(const VectorDouble& point, bool eraseZeroes = true)
 {
+    if(compiledFunction.isLoaded())
+        return (compiledFunction.calculateGradient(point, eraseZeroes));
+
     SparseVariableVector gradient = QuadraticObjectiveFunction::calculateGradient(point, eraseZeroes);
 
     if(this->properties.hasNonlinearExpression)
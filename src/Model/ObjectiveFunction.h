@@ -14,6 +14,8 @@
 #include "Variables.h"
 #include "Terms.h"
 #include "NonlinearExpressions.h"
+#include "NonlinearExpressionTape.h"
+#include "ModelCodeGenerator.h"
 
 #include <vector>
 
@@ -344,6 +346,12 @@ public:
     NonlinearExpressionPtr nonlinearExpression;
     FactorableFunctionPtr factorableFunction;
 
+    // The compiled nonlinear expression, used instead of the expression tree when evaluating function values
+    NonlinearExpressionTape nonlinearExpressionTape;
+
+    // The whole function as compiled code, used instead of all the other evaluations if loaded
+    CompiledFunction compiledFunction;
+
     CppAD::sparse_rc<std::vector<size_t>> nonlinearGradientSparsityPattern;
     CppAD::sparse_rc<std::vector<size_t>> nonlinearHessianSparsityPattern;
 
@@ -373,6 +381,7 @@ public:
     void add(NonlinearExpressionPtr expression);
 
     void updateFactorableFunction();
+    void updateNonlinearExpressionTape();
 
     void updateProperties() override;
 
@@ -17,6 +17,9 @@
 #include "../Model/Simplifications.h"
 #include "../Tasks/TaskReformulateProblem.h"
 
+#include <algorithm>
+#include <functional>
+
 namespace SHOT
 {
 
@@ -115,7 +118,7 @@ void Problem::updateConstraints()
                 T->coefficient *= -1.0;
 
             if(C->nonlinearExpression)
-                C->nonlinearExpression = simplify(std::make_shared<ExpressionNegate>(C->nonlinearExpression));
+                C->nonlinearExpression = simplify(makeExpression<ExpressionNegate>(C->nonlinearExpression));
 
             C->constant *= -1.0;
         }
@@ -152,7 +155,7 @@ void Problem::updateConstraints()
 
             if(C->nonlinearExpression)
                 auxConstraint->nonlinearExpression = simplify(
-                    std::make_shared<ExpressionNegate>(copyNonlinearExpression(C->nonlinearExpression.get(), this)));
+                    makeExpression<ExpressionNegate>(copyNonlinearExpression(C->nonlinearExpression.get(), this)));
 
             auxConstraint->updateProperties();
             auxConstraints.push_back(auxConstraint);
@@ -535,6 +538,9 @@ void Problem::updateProperties()
 
 void Problem::updateFactorableFunctions()
 {
+    nonlinearExpressionsJacobianInitialized = false;
+    nonlinearExpressionsHessianInitialized = false;
+
     if(properties.numberOfVariablesInNonlinearExpressions == 0)
         return;
 
@@ -556,6 +562,9 @@ void Problem::updateFactorableFunctions()
 
     CppAD::Independent(factorableFunctionVariables);
 
+    // Subexpressions shared between the nonlinear expressions are only recorded once
+    FactorableFunctionCache factorableFunctionCache;
+
     int nonlinearExpressionCounter = 0;
 
     for(auto& C : nonlinearConstraints)
@@ -585,11 +594,184 @@ void Problem::updateFactorableFunctions()
     if(factorableFunctions.size() > 0)
     {
         ADFunctions.Dependent(factorableFunctionVariables, factorableFunctions);
-        // ADFunctions.optimize();
+
+        if(env->settings->getSetting<bool>("NonlinearExpressions.OptimizeTape", "Model"))
+        {
+            size_t numberOfOperations = ADFunctions.size_op();
+            size_t numberOfTapeVariables = ADFunctions.size_var();
+
+            // Comparison operators are only needed for checking if the tape is valid in other points than it was
+            // recorded in, and this is never done
+            ADFunctions.optimize("no_compare_op");
+
+            env->output->outputDebug(fmt::format(
+                "  Optimized the tape of the nonlinear expressions from {} to {} operations and {} to {} variables.",
+                numberOfOperations, ADFunctions.size_op(), numberOfTapeVariables, ADFunctions.size_var()));
+        }
+        else
+        {
+            env->output->outputDebug(
+                fmt::format("  The tape of the nonlinear expressions has {} operations and {} variables.",
+                    ADFunctions.size_op(), ADFunctions.size_var()));
+        }
     }
 }
 
-Problem::Problem(EnvironmentPtr env) : env(env) {}
+void Problem::initializeNonlinearExpressionsJacobian()
+{
+    size_t numberOfVariables = ADFunctions.Domain();
+
+    CppAD::sparse_rc<std::vector<size_t>> identity(numberOfVariables, numberOfVariables, numberOfVariables);
+
+    for(size_t i = 0; i < numberOfVariables; i++)
+        identity.set(i, i, i);
+
+    ADFunctions.for_jac_sparsity(identity, false, false, false, nonlinearExpressionsJacobianSparsityPattern);
+
+    nonlinearExpressionsJacobian = CppAD::sparse_rcv<std::vector<size_t>, std::vector<double>>(
+        nonlinearExpressionsJacobianSparsityPattern);
+
+    // The coloring is calculated in the first call to sparse_jac_rev and is then reused
+    nonlinearExpressionsJacobianWork.clear();
+
+    nonlinearExpressionsJacobianVariables.clear();
+    nonlinearExpressionsJacobianVariables.resize(numberOfVariables);
+
+    for(auto& V : nonlinearVariables)
+    {
+        if(V->properties.inNonlinearExpression)
+            nonlinearExpressionsJacobianVariables[V->properties.nonlinearVariableIndex] = V;
+    }
+
+    nonlinearExpressionsJacobianInitialized = true;
+}
+
+void Problem::updateNonlinearExpressionTapes()
+{
+    for(auto& C : nonlinearConstraints)
+        C->updateNonlinearExpressionTape();
+
+    if(objectiveFunction->properties.hasNonlinearExpression)
+        std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objectiveFunction)->updateNonlinearExpressionTape();
+}
+
+void Problem::updateCompiledFunctions()
+{
+    for(auto& C : nonlinearConstraints)
+        C->compiledFunction.clear();
+
+    auto nonlinearObjective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objectiveFunction);
+
+    if(nonlinearObjective)
+        nonlinearObjective->compiledFunction.clear();
+
+    if(nonlinearConstraints.size() == 0 && !nonlinearObjective)
+        return;
+
+    ModelCodeGenerator generator(env);
+
+    for(auto& C : nonlinearConstraints)
+    {
+        generator.add(C->linearTerms, C->quadraticTerms, C->monomialTerms, C->signomialTerms,
+            C->properties.hasNonlinearExpression ? C->nonlinearExpression : nullptr, C->constant);
+    }
+
+    if(nonlinearObjective)
+    {
+        generator.add(nonlinearObjective->linearTerms, nonlinearObjective->quadraticTerms,
+            nonlinearObjective->monomialTerms, nonlinearObjective->signomialTerms,
+            nonlinearObjective->properties.hasNonlinearExpression ? nonlinearObjective->nonlinearExpression : nullptr,
+            nonlinearObjective->constant);
+    }
+
+    auto compiledFunctions = generator.compile();
+
+    if(compiledFunctions.size() != generator.size())
+    {
+        env->output->outputWarning(" Using the interpreted model functions instead of compiled code.");
+        return;
+    }
+
+    // The compiled functions are checked against the interpreted ones in a point inside the variable bounds
+    VectorDouble point(properties.numberOfVariables);
+
+    for(auto& V : allVariables)
+    {
+        if(V->lowerBound > SHOT_DBL_MIN && V->upperBound < SHOT_DBL_MAX)
+            point[V->index] = 0.5 * (V->lowerBound + V->upperBound);
+        else
+            point[V->index] = std::max(V->lowerBound, std::min(V->upperBound, 0.5));
+    }
+
+    auto isEqual = [](double first, double second) {
+        if(!std::isfinite(first) || !std::isfinite(second))
+            return (std::isfinite(first) == std::isfinite(second));
+
+        return (std::abs(first - second) <= 1e-6 * std::max(1.0, std::abs(first)));
+    };
+
+    auto isSameGradient = [&](const SparseVariableVector& first, const SparseVariableVector& second) {
+        for(auto& E : first)
+        {
+            auto element = second.find(E.first);
+
+            if(!isEqual(E.second, element != second.end() ? element->second : 0.0))
+                return (false);
+        }
+
+        for(auto& E : second)
+        {
+            if(first.find(E.first) == first.end() && !isEqual(E.second, 0.0))
+                return (false);
+        }
+
+        return (true);
+    };
+
+    int numberOfCompiledFunctions = 0;
+
+    // The compiled function is stored in the constraint or objective only if it is correct
+    auto verify = [&](CompiledFunction& compiledFunction, std::function<double()> calculateValue,
+                      std::function<SparseVariableVector()> calculateGradient, const std::string& name) {
+        if(isEqual(calculateValue(), compiledFunction.calculateValue(point))
+            && isSameGradient(calculateGradient(), compiledFunction.calculateGradient(point, false)))
+        {
+            numberOfCompiledFunctions++;
+            return (true);
+        }
+
+        env->output->outputWarning(fmt::format(" The compiled code for {} is not used since its value or gradient "
+                                               "does not match the interpreted function.",
+            name));
+
+        return (false);
+    };
+
+    for(size_t i = 0; i < nonlinearConstraints.size(); i++)
+    {
+        auto& C = nonlinearConstraints[i];
+
+        if(verify(
+               compiledFunctions[i], [&]() { return (C->calculateFunctionValue(point)); },
+               [&]() { return (C->calculateGradient(point, false)); }, "constraint " + C->name))
+        {
+            C->compiledFunction = compiledFunctions[i];
+        }
+    }
+
+    if(nonlinearObjective
+        && verify(
+            compiledFunctions.back(), [&]() { return (nonlinearObjective->calculateValue(point)); },
+            [&]() { return (nonlinearObjective->calculateGradient(point, false)); }, "the objective function"))
+    {
+        nonlinearObjective->compiledFunction = compiledFunctions.back();
+    }
+
+    env->output->outputDebug(fmt::format(
+        "  Using compiled code for {} of {} nonlinear functions.", numberOfCompiledFunctions, generator.size()));
+}
+
+Problem::Problem(EnvironmentPtr env) : env(env), expressionArena(ExpressionArena::startNew()) {}
 
 Problem::~Problem()
 {
@@ -617,7 +799,26 @@ void Problem::finalize()
     updateVariables();
     updateConstraints();
     updateProperties();
+
+    if(env->settings->getSetting<bool>("NonlinearExpressions.EliminateCommonSubexpressions", "Model"))
+    {
+        int numberOfEliminatedNodes = eliminateCommonSubexpressions(shared_from_this());
+
+        if(numberOfEliminatedNodes > 0)
+        {
+            env->output->outputDebug(fmt::format(
+                "  Eliminated {} nodes from the nonlinear expressions by sharing identical subexpressions.",
+                numberOfEliminatedNodes));
+        }
+
+        properties.numberOfEliminatedExpressionNodes += numberOfEliminatedNodes;
+    }
+
     updateFactorableFunctions();
+    updateNonlinearExpressionTapes();
+
+    if(env->settings->getSetting<bool>("NonlinearExpressions.CompiledCode.Use", "Model"))
+        updateCompiledFunctions();
 
     // Do not do bound tightening on problems solved by MIP solver
     if(this->properties.numberOfNonlinearConstraints > 0
@@ -1040,6 +1241,185 @@ std::shared_ptr<std::vector<std::pair<VariablePtr, VariablePtr>>> Problem::getLa
     return (lagrangianHessianSparsityPattern);
 }
 
+void Problem::initializeNonlinearExpressionsHessian()
+{
+    size_t numberOfVariables = ADFunctions.Domain();
+
+    // The sparsity pattern of the sum of the Hessians of all nonlinear expressions
+    std::vector<bool> selectedVariables(numberOfVariables, true);
+    std::vector<bool> selectedExpressions(ADFunctions.Range(), true);
+
+    ADFunctions.for_hes_sparsity(
+        selectedVariables, selectedExpressions, false, nonlinearExpressionsHessianSparsityPattern);
+
+    const std::vector<size_t>& row(nonlinearExpressionsHessianSparsityPattern.row());
+    const std::vector<size_t>& col(nonlinearExpressionsHessianSparsityPattern.col());
+
+    if(!nonlinearExpressionsJacobianInitialized)
+        initializeNonlinearExpressionsJacobian();
+
+    // Only the elements above the diagonal are calculated since the Hessian is symmetric
+    std::vector<size_t> upperTriangularElements;
+
+    for(size_t k = 0; k < nonlinearExpressionsHessianSparsityPattern.nnz(); k++)
+    {
+        if(row[k] <= col[k])
+            upperTriangularElements.push_back(k);
+    }
+
+    CppAD::sparse_rc<std::vector<size_t>> upperTriangularPattern(
+        numberOfVariables, numberOfVariables, upperTriangularElements.size());
+
+    nonlinearExpressionsHessianPositions.resize(upperTriangularElements.size());
+
+    for(size_t i = 0; i < upperTriangularElements.size(); i++)
+    {
+        size_t k = upperTriangularElements[i];
+        upperTriangularPattern.set(i, row[k], col[k]);
+
+        nonlinearExpressionsHessianPositions[i] = getLagrangianHessianPosition(
+            nonlinearExpressionsJacobianVariables[row[k]], nonlinearExpressionsJacobianVariables[col[k]]);
+    }
+
+    nonlinearExpressionsHessian
+        = CppAD::sparse_rcv<std::vector<size_t>, std::vector<double>>(upperTriangularPattern);
+
+    // The coloring is calculated in the first call to sparse_hes and is then reused
+    nonlinearExpressionsHessianWork.clear();
+
+    nonlinearExpressionsHessianInitialized = true;
+}
+
+int Problem::getLagrangianHessianPosition(const VariablePtr& firstVariable, const VariablePtr& secondVariable)
+{
+    auto lagrangianPattern = getLagrangianHessianSparsityPattern();
+
+    auto element = std::lower_bound(lagrangianPattern->begin(), lagrangianPattern->end(),
+        std::make_pair(firstVariable->index, secondVariable->index),
+        [](const std::pair<VariablePtr, VariablePtr>& element, const std::pair<int, int>& indices) {
+            return (std::make_pair(element.first->index, element.second->index) < indices);
+        });
+
+    if(element == lagrangianPattern->end() || element->first->index != firstVariable->index
+        || element->second->index != secondVariable->index)
+        return (-1);
+
+    return (element - lagrangianPattern->begin());
+}
+
+void Problem::addToLagrangianHessian(const SparseVariableMatrix& hessian, double factor, double* values)
+{
+    for(auto& E : hessian)
+    {
+        int position = getLagrangianHessianPosition(E.first.first, E.first.second);
+
+        assert(position >= 0);
+
+        if(position >= 0)
+            values[position] += factor * E.second;
+    }
+}
+
+void Problem::calculateLagrangianHessian(
+    const VectorDouble& point, double objectiveFactor, const double* multipliers, double* values)
+{
+    auto lagrangianPattern = getLagrangianHessianSparsityPattern();
+
+    for(size_t i = 0; i < lagrangianPattern->size(); i++)
+        values[i] = 0.0;
+
+    // The nonlinear expressions in all constraints and the objective are differentiated together
+    if(factorableFunctions.size() > 0)
+    {
+        if(!nonlinearExpressionsHessianInitialized)
+            initializeNonlinearExpressionsHessian();
+
+        VectorDouble weights(ADFunctions.Range(), 0.0);
+        bool hasNonzeroWeight = false;
+
+        for(auto& C : constraintsWithNonlinearExpressions)
+        {
+            weights[C->nonlinearExpressionIndex] = multipliers[C->index];
+            hasNonzeroWeight = hasNonzeroWeight || multipliers[C->index] != 0.0;
+        }
+
+        if(objectiveFunction->properties.hasNonlinearExpression)
+        {
+            int expressionIndex
+                = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objectiveFunction)->nonlinearExpressionIndex;
+
+            if(expressionIndex >= 0)
+            {
+                weights[expressionIndex] = objectiveFactor;
+                hasNonzeroWeight = hasNonzeroWeight || objectiveFactor != 0.0;
+            }
+        }
+
+        if(hasNonzeroWeight)
+        {
+            VectorDouble pointNonlinearSubset(nonlinearExpressionsJacobianVariables.size(), 0.0);
+
+            for(size_t i = 0; i < nonlinearExpressionsJacobianVariables.size(); i++)
+                pointNonlinearSubset[i] = point[nonlinearExpressionsJacobianVariables[i]->index];
+
+            ADFunctions.sparse_hes(pointNonlinearSubset, weights, nonlinearExpressionsHessian,
+                nonlinearExpressionsHessianSparsityPattern, "cppad.symmetric", nonlinearExpressionsHessianWork);
+
+            const std::vector<double>& hessianValues(nonlinearExpressionsHessian.val());
+
+            for(size_t k = 0; k < hessianValues.size(); k++)
+            {
+                int position = nonlinearExpressionsHessianPositions[k];
+
+                assert(position >= 0);
+
+                if(position >= 0)
+                    values[position] += hessianValues[k];
+            }
+        }
+    }
+
+    // The remaining quadratic, monomial and signomial terms
+    if(objectiveFactor != 0.0)
+    {
+        if(auto objective = std::dynamic_pointer_cast<QuadraticObjectiveFunction>(objectiveFunction))
+            addToLagrangianHessian(objective->QuadraticObjectiveFunction::calculateHessian(point, false),
+                objectiveFactor, values);
+
+        if(auto objective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objectiveFunction))
+        {
+            if(objective->properties.hasMonomialTerms)
+                addToLagrangianHessian(objective->monomialTerms.calculateHessian(point), objectiveFactor, values);
+
+            if(objective->properties.hasSignomialTerms)
+                addToLagrangianHessian(objective->signomialTerms.calculateHessian(point), objectiveFactor, values);
+        }
+    }
+
+    for(auto& C : quadraticConstraints)
+    {
+        if(multipliers[C->index] != 0.0)
+            addToLagrangianHessian(C->calculateHessian(point, false), multipliers[C->index], values);
+    }
+
+    for(auto& C : nonlinearConstraints)
+    {
+        double multiplier = multipliers[C->index];
+
+        if(multiplier == 0.0)
+            continue;
+
+        if(C->properties.hasQuadraticTerms)
+            addToLagrangianHessian(C->QuadraticConstraint::calculateHessian(point, false), multiplier, values);
+
+        if(C->properties.hasMonomialTerms)
+            addToLagrangianHessian(C->monomialTerms.calculateHessian(point), multiplier, values);
+
+        if(C->properties.hasSignomialTerms)
+            addToLagrangianHessian(C->signomialTerms.calculateHessian(point), multiplier, values);
+    }
+}
+
 std::optional<NumericConstraintValue> Problem::getMostDeviatingNumericConstraint(const VectorDouble& point)
 {
     return (this->getMostDeviatingNumericConstraint(point, numericConstraints));
@@ -1280,6 +1660,163 @@ NumericConstraintValue Problem::getMaxNumericConstraintValue(const VectorDouble&
     return value;
 }
 
+template <typename T>
+VectorDouble calculateConstraintFunctionValues(
+    const VectorDouble& points, size_t numberOfPoints, const std::vector<std::shared_ptr<T>>& constraintSelection)
+{
+    VectorDouble values(numberOfPoints * constraintSelection.size());
+
+    for(size_t i = 0; i < constraintSelection.size(); i++)
+        constraintSelection[i]->calculateFunctionValues(points.data(), numberOfPoints, &values[i * numberOfPoints]);
+
+    return (values);
+}
+
+VectorDouble Problem::calculateConstraintFunctionValues(
+    const VectorDouble& points, size_t numberOfPoints, const NumericConstraints& constraintSelection)
+{
+    assert(points.size() == numberOfPoints * properties.numberOfVariables);
+    return (SHOT::calculateConstraintFunctionValues(points, numberOfPoints, constraintSelection));
+}
+
+VectorDouble Problem::calculateConstraintFunctionValues(
+    const VectorDouble& points, size_t numberOfPoints, const NonlinearConstraints& constraintSelection)
+{
+    assert(points.size() == numberOfPoints * properties.numberOfVariables);
+    return (SHOT::calculateConstraintFunctionValues(points, numberOfPoints, constraintSelection));
+}
+
+VectorDouble Problem::getPointBlock(const std::vector<VectorDouble>& points)
+{
+    size_t numberOfPoints = points.size();
+    VectorDouble block(numberOfPoints * properties.numberOfVariables);
+
+    for(size_t i = 0; i < numberOfPoints; i++)
+    {
+        // The points may contain additional variables, e.g. from the dual problem, which are ignored
+        assert((int)points[i].size() >= properties.numberOfVariables);
+
+        for(int j = 0; j < properties.numberOfVariables; j++)
+            block[j * numberOfPoints + i] = points[i][j];
+    }
+
+    return (block);
+}
+
+std::vector<SparseVariableVector> Problem::calculateConstraintGradients(
+    const VectorDouble& point, const NumericConstraints& constraintSelection, bool eraseZeroes)
+{
+    std::vector<SparseVariableVector> gradients;
+    gradients.reserve(constraintSelection.size());
+
+    // The rows in the Jacobian of the nonlinear expressions that are needed, with the corresponding constraint
+    std::vector<int> selectionIndexForExpression(properties.numberOfNonlinearExpressions, -1);
+    int numberOfNonlinearExpressions = 0;
+
+    for(size_t i = 0; i < constraintSelection.size(); i++)
+    {
+        auto& C = constraintSelection[i];
+
+        if(C->properties.hasNonlinearExpression)
+        {
+            auto nonlinearConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(C);
+            int expressionIndex = nonlinearConstraint->nonlinearExpressionIndex;
+
+            // Compiled constraints calculate their full gradients themselves
+            if(expressionIndex >= 0 && !nonlinearConstraint->compiledFunction.isLoaded())
+            {
+                selectionIndexForExpression[expressionIndex] = i;
+                numberOfNonlinearExpressions++;
+            }
+        }
+    }
+
+    // A single expression is cheaper to differentiate by itself
+    if(numberOfNonlinearExpressions <= 1)
+    {
+        for(auto& C : constraintSelection)
+            gradients.push_back(C->calculateGradient(point, eraseZeroes));
+
+        return (gradients);
+    }
+
+    if(!nonlinearExpressionsJacobianInitialized)
+        initializeNonlinearExpressionsJacobian();
+
+    VectorDouble pointNonlinearSubset(nonlinearExpressionsJacobianVariables.size(), 0.0);
+
+    for(size_t i = 0; i < nonlinearExpressionsJacobianVariables.size(); i++)
+        pointNonlinearSubset[i] = point[nonlinearExpressionsJacobianVariables[i]->index];
+
+    ADFunctions.sparse_jac_rev(pointNonlinearSubset, nonlinearExpressionsJacobian,
+        nonlinearExpressionsJacobianSparsityPattern, "cppad", nonlinearExpressionsJacobianWork);
+
+    std::vector<SparseVariableVector> nonlinearExpressionGradients(constraintSelection.size());
+
+    const std::vector<size_t>& row(nonlinearExpressionsJacobian.row());
+    const std::vector<size_t>& col(nonlinearExpressionsJacobian.col());
+    const std::vector<double>& value(nonlinearExpressionsJacobian.val());
+
+    for(auto k : nonlinearExpressionsJacobian.row_major())
+    {
+        int selectionIndex = selectionIndexForExpression[row[k]];
+
+        if(selectionIndex < 0 || value[k] == 0.0)
+            continue;
+
+        nonlinearExpressionGradients[selectionIndex].add(nonlinearExpressionsJacobianVariables[col[k]], value[k]);
+    }
+
+    for(size_t i = 0; i < constraintSelection.size(); i++)
+    {
+        auto& C = constraintSelection[i];
+
+        if(C->properties.hasNonlinearExpression
+            && !std::dynamic_pointer_cast<NonlinearConstraint>(C)->compiledFunction.isLoaded())
+        {
+            gradients.push_back(std::dynamic_pointer_cast<NonlinearConstraint>(C)->calculateGradient(
+                point, nonlinearExpressionGradients[i], eraseZeroes));
+        }
+        else
+        {
+            gradients.push_back(C->calculateGradient(point, eraseZeroes));
+        }
+    }
+
+    return (gradients);
+}
+
+std::vector<NumericConstraintValue> Problem::getMaxNumericConstraintValues(
+    const std::vector<VectorDouble>& points, const NonlinearConstraints& constraintSelection)
+{
+    assert(constraintSelection.size() > 0);
+
+    size_t numberOfPoints = points.size();
+    auto values = calculateConstraintFunctionValues(getPointBlock(points), numberOfPoints, constraintSelection);
+
+    std::vector<NumericConstraintValue> maxValues;
+    maxValues.reserve(numberOfPoints);
+
+    for(size_t i = 0; i < numberOfPoints; i++)
+    {
+        auto value = constraintSelection[0]->getNumericValue(values[i]);
+
+        for(size_t j = 1; j < constraintSelection.size(); j++)
+        {
+            auto tmpValue = constraintSelection[j]->getNumericValue(values[j * numberOfPoints + i]);
+
+            if(tmpValue.normalizedValue > value.normalizedValue)
+            {
+                value = tmpValue;
+            }
+        }
+
+        maxValues.push_back(value);
+    }
+
+    return (maxValues);
+}
+
 template <typename T>
 NumericConstraintValues Problem::getAllDeviatingConstraints(
     const VectorDouble& point, double tolerance, std::vector<T> constraintSelection, double correction)
@@ -1318,6 +1855,98 @@ NumericConstraintValues Problem::getFractionOfDeviatingNonlinearConstraints(
     return values;
 }
 
+std::vector<NumericConstraintValues> Problem::getFractionOfDeviatingNonlinearConstraints(
+    const std::vector<VectorDouble>& points, double tolerance, double fraction)
+{
+    size_t numberOfPoints = points.size();
+    std::vector<NumericConstraintValues> deviatingValues(numberOfPoints);
+
+    if(numberOfPoints == 0 || this->nonlinearConstraints.size() == 0)
+        return (deviatingValues);
+
+    if(fraction > 1)
+        fraction = 1;
+    else if(fraction < 0)
+        fraction = 0;
+
+    int fractionNumbers = std::max(1, (int)ceil(fraction * this->nonlinearConstraints.size()));
+
+    auto values = calculateConstraintFunctionValues(getPointBlock(points), numberOfPoints, this->nonlinearConstraints);
+
+    for(size_t i = 0; i < numberOfPoints; i++)
+    {
+        auto& pointValues = deviatingValues[i];
+
+        for(size_t j = 0; j < this->nonlinearConstraints.size(); j++)
+        {
+            auto constraintValue = this->nonlinearConstraints[j]->getNumericValue(values[j * numberOfPoints + i]);
+
+            if(constraintValue.normalizedValue > tolerance)
+                pointValues.push_back(constraintValue);
+        }
+
+        std::sort(pointValues.begin(), pointValues.end(), std::greater<NumericConstraintValue>());
+
+        if((int)pointValues.size() > fractionNumbers)
+            pointValues.resize(fractionNumbers);
+    }
+
+    return (deviatingValues);
+}
+
+NumericConstraintValues Problem::getFractionOfDeviatingNonlinearConstraints(
+    const SolutionPoint& point, double tolerance, double fraction)
+{
+    if(!point.nonlinearConstraintValues)
+        return (getFractionOfDeviatingNonlinearConstraints(point.point, tolerance, fraction));
+
+    if(fraction > 1)
+        fraction = 1;
+    else if(fraction < 0)
+        fraction = 0;
+
+    int fractionNumbers = std::max(1, (int)ceil(fraction * this->nonlinearConstraints.size()));
+
+    NumericConstraintValues values;
+
+    // The stored values are sorted, so the deviating ones are first
+    for(auto& V : *point.nonlinearConstraintValues)
+    {
+        if((int)values.size() >= fractionNumbers || !(V.normalizedValue > tolerance))
+            break;
+
+        values.push_back(V);
+    }
+
+    return (values);
+}
+
+std::vector<NumericConstraintValues> Problem::getFractionOfDeviatingNonlinearConstraints(
+    const std::vector<SolutionPoint>& points, double tolerance, double fraction)
+{
+    bool valuesStored = std::all_of(
+        points.begin(), points.end(), [](const SolutionPoint& P) { return (P.nonlinearConstraintValues != nullptr); });
+
+    if(!valuesStored)
+    {
+        std::vector<VectorDouble> tmpPoints;
+        tmpPoints.reserve(points.size());
+
+        for(auto& P : points)
+            tmpPoints.push_back(P.point);
+
+        return (getFractionOfDeviatingNonlinearConstraints(tmpPoints, tolerance, fraction));
+    }
+
+    std::vector<NumericConstraintValues> deviatingValues;
+    deviatingValues.reserve(points.size());
+
+    for(auto& P : points)
+        deviatingValues.push_back(getFractionOfDeviatingNonlinearConstraints(P, tolerance, fraction));
+
+    return (deviatingValues);
+}
+
 NumericConstraintValues Problem::getAllDeviatingNumericConstraints(const VectorDouble& point, double tolerance)
 {
     return getAllDeviatingConstraints(point, tolerance, numericConstraints);
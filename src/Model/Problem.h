@@ -63,6 +63,7 @@ struct ProblemProperties
     int numberOfQuadraticConstraints = 0;
     int numberOfNonlinearConstraints = 0;
     int numberOfNonlinearExpressions = 0; // This includes a possible nonlinear objective
+    int numberOfEliminatedExpressionNodes = 0; // Replaced by identical subexpressions
 
     std::string name = "";
     std::string description = "";
@@ -82,13 +83,39 @@ private:
 
     NonlinearConstraints constraintsWithNonlinearExpressions;
 
+    // The Jacobian of all nonlinear expressions, its sparsity pattern and coloring is calculated once and then reused
+    CppAD::sparse_rc<std::vector<size_t>> nonlinearExpressionsJacobianSparsityPattern;
+    CppAD::sparse_rcv<std::vector<size_t>, std::vector<double>> nonlinearExpressionsJacobian;
+    CppAD::sparse_jac_work nonlinearExpressionsJacobianWork;
+    Variables nonlinearExpressionsJacobianVariables; // The variable for each column in the Jacobian
+    bool nonlinearExpressionsJacobianInitialized = false;
+
+    // The Hessian of the Lagrangian for the nonlinear expressions, with the position of each element in the sparsity
+    // pattern returned by getLagrangianHessianSparsityPattern
+    CppAD::sparse_rc<std::vector<size_t>> nonlinearExpressionsHessianSparsityPattern;
+    CppAD::sparse_rcv<std::vector<size_t>, std::vector<double>> nonlinearExpressionsHessian;
+    CppAD::sparse_hes_work nonlinearExpressionsHessianWork;
+    std::vector<int> nonlinearExpressionsHessianPositions;
+    bool nonlinearExpressionsHessianInitialized = false;
+
     void updateVariables();
     void updateConstraints();
     void updateFactorableFunctions();
+    void updateNonlinearExpressionTapes();
+    void updateCompiledFunctions();
+
+    void initializeNonlinearExpressionsJacobian();
+    void initializeNonlinearExpressionsHessian();
+
+    int getLagrangianHessianPosition(const VariablePtr& firstVariable, const VariablePtr& secondVariable);
+    void addToLagrangianHessian(const SparseVariableMatrix& hessian, double factor, double* values);
 
 public:
     EnvironmentPtr env;
 
+    // Contains the nonlinear expression nodes created in the same thread after the problem
+    std::shared_ptr<ExpressionArena> expressionArena;
+
     Problem(EnvironmentPtr env);
 
     virtual ~Problem();
@@ -166,6 +193,12 @@ public:
     std::shared_ptr<std::vector<std::pair<VariablePtr, VariablePtr>>> getConstraintsHessianSparsityPattern();
     std::shared_ptr<std::vector<std::pair<VariablePtr, VariablePtr>>> getLagrangianHessianSparsityPattern();
 
+    // Calculates objectiveFactor times the Hessian of the objective plus the Hessians of the numeric constraints times
+    // their multipliers. The multipliers are given for all numeric constraints and the values are written in the
+    // order of the elements in getLagrangianHessianSparsityPattern
+    void calculateLagrangianHessian(
+        const VectorDouble& point, double objectiveFactor, const double* multipliers, double* values);
+
     std::optional<NumericConstraintValue> getMostDeviatingNumericConstraint(const VectorDouble& point);
 
     std::optional<NumericConstraintValue> getMostDeviatingNonlinearConstraint(const VectorDouble& point);
@@ -198,6 +231,25 @@ public:
     NumericConstraintValue getMaxNumericConstraintValue(const VectorDouble& point,
         const std::vector<NumericConstraint*>& constraintSelection, std::vector<NumericConstraint*>& activeConstraints);
 
+    // Calculates the constraint function values in several points at once. The points are given as a column-major
+    // block, i.e. the value of the variable with index j in point i is points[j * numberOfPoints + i], and the result
+    // is a column-major numberOfPoints x constraintSelection.size() matrix
+    VectorDouble calculateConstraintFunctionValues(
+        const VectorDouble& points, size_t numberOfPoints, const NumericConstraints& constraintSelection);
+    VectorDouble calculateConstraintFunctionValues(
+        const VectorDouble& points, size_t numberOfPoints, const NonlinearConstraints& constraintSelection);
+
+    // Packs the points into a column-major block that can be used in calculateConstraintFunctionValues
+    VectorDouble getPointBlock(const std::vector<VectorDouble>& points);
+
+    // Calculates the gradients of the constraints in the same point. The nonlinear expressions of all constraints are
+    // differentiated in one sparse Jacobian sweep
+    std::vector<SparseVariableVector> calculateConstraintGradients(
+        const VectorDouble& point, const NumericConstraints& constraintSelection, bool eraseZeroes = true);
+
+    std::vector<NumericConstraintValue> getMaxNumericConstraintValues(
+        const std::vector<VectorDouble>& points, const NonlinearConstraints& constraintSelection);
+
     template <typename T>
     NumericConstraintValues getAllDeviatingConstraints(
         const VectorDouble& point, double tolerance, std::vector<T> constraintSelection, double correction = 0.0);
@@ -205,6 +257,16 @@ public:
     NumericConstraintValues getFractionOfDeviatingNonlinearConstraints(
         const VectorDouble& point, double tolerance, double fraction, double correction = 0.0);
 
+    std::vector<NumericConstraintValues> getFractionOfDeviatingNonlinearConstraints(
+        const std::vector<VectorDouble>& points, double tolerance, double fraction);
+
+    // Uses the nonlinear constraint values stored in the solution points if available
+    NumericConstraintValues getFractionOfDeviatingNonlinearConstraints(
+        const SolutionPoint& point, double tolerance, double fraction);
+
+    std::vector<NumericConstraintValues> getFractionOfDeviatingNonlinearConstraints(
+        const std::vector<SolutionPoint>& points, double tolerance, double fraction);
+
     virtual NumericConstraintValues getAllDeviatingNumericConstraints(const VectorDouble& point, double tolerance);
 
     virtual NumericConstraintValues getAllDeviatingLinearConstraints(const VectorDouble& point, double tolerance);
@@ -216,7 +216,7 @@ void simplifyNonlinearExpressions(
                     auto variable = std::dynamic_pointer_cast<ExpressionVariable>(T);
 
                     C->linearTerms.add(std::make_shared<LinearTerm>(1.0, variable->variable));
-                    T = std::make_shared<ExpressionConstant>(0.0); // Will be removed during simplification later on
+                    T = makeExpression<ExpressionConstant>(0.0); // Will be removed during simplification later on
                 }
                 else if(T->getType() == E_NonlinearExpressionTypes::Product && T->getNumberOfChildren() == 2)
                 {
@@ -231,7 +231,7 @@ void simplifyNonlinearExpressions(
                             = std::dynamic_pointer_cast<ExpressionVariable>(product->children.at(1))->variable;
 
                         C->linearTerms.add(std::make_shared<LinearTerm>(constant, variable));
-                        T = std::make_shared<ExpressionConstant>(0.0); // Will be removed during simplification later on
+                        T = makeExpression<ExpressionConstant>(0.0); // Will be removed during simplification later on
                     }
                     else if(product->children.at(1)->getType() == E_NonlinearExpressionTypes::Constant
                         && product->children.at(0)->getType() == E_NonlinearExpressionTypes::Variable)
@@ -242,7 +242,7 @@ void simplifyNonlinearExpressions(
                             = std::dynamic_pointer_cast<ExpressionVariable>(product->children.at(0))->variable;
 
                         C->linearTerms.add(std::make_shared<LinearTerm>(constant, variable));
-                        T = std::make_shared<ExpressionConstant>(0.0); // Will be removed during simplification later on
+                        T = makeExpression<ExpressionConstant>(0.0); // Will be removed during simplification later on
                     }
                     else if(product->children.at(1)->getType() == E_NonlinearExpressionTypes::Variable
                         && product->children.at(0)->getType() == E_NonlinearExpressionTypes::Variable)
@@ -253,7 +253,7 @@ void simplifyNonlinearExpressions(
                             = std::dynamic_pointer_cast<ExpressionVariable>(product->children.at(1))->variable;
 
                         C->quadraticTerms.add(std::make_shared<QuadraticTerm>(1.0, firstVariable, secondVariable));
-                        T = std::make_shared<ExpressionConstant>(0.0); // Will be removed during simplification later on
+                        T = makeExpression<ExpressionConstant>(0.0); // Will be removed during simplification later on
                     }
                 }
                 else if(T->getType() == E_NonlinearExpressionTypes::Product && T->getNumberOfChildren() == 3)
@@ -294,7 +294,7 @@ void simplifyNonlinearExpressions(
                             std::make_shared<QuadraticTerm>(constant, variables.at(0), variables.at(1)));
                     }
 
-                    T = std::make_shared<ExpressionConstant>(0.0); // Will be removed during simplification later on
+                    T = makeExpression<ExpressionConstant>(0.0); // Will be removed during simplification later on
                 }
             }
         }
@@ -310,6 +310,133 @@ void simplifyNonlinearExpressions(
     }
 }
 
+namespace
+{
+    // Replaces identical subexpressions with the same node, using the structural hash of each node. Since the children
+    // of a node are made unique before the node itself, two nodes are identical exactly when operator== is true, i.e.
+    // when they have the same type, constant or variable and the same child nodes.
+    class CommonSubexpressionEliminator
+    {
+    public:
+        NonlinearExpressionPtr eliminate(const NonlinearExpressionPtr& expression)
+        {
+            auto visited = uniqueNodes.find(expression.get());
+
+            if(visited != uniqueNodes.end())
+                return (visited->second);
+
+            size_t hash = static_cast<size_t>(expression->getType());
+
+            switch(expression->getType())
+            {
+            case(E_NonlinearExpressionTypes::Constant):
+                combineHash(
+                    hash, std::hash<double>()(std::static_pointer_cast<ExpressionConstant>(expression)->constant));
+                break;
+
+            case(E_NonlinearExpressionTypes::Variable):
+                combineHash(hash, std::static_pointer_cast<ExpressionVariable>(expression)->variable->index);
+                break;
+
+            case(E_NonlinearExpressionTypes::Divide):
+            case(E_NonlinearExpressionTypes::Power):
+            {
+                auto binary = std::static_pointer_cast<ExpressionBinary>(expression);
+                binary->firstChild = eliminate(binary->firstChild);
+                binary->secondChild = eliminate(binary->secondChild);
+
+                combineHash(hash, std::hash<NonlinearExpression*>()(binary->firstChild.get()));
+                combineHash(hash, std::hash<NonlinearExpression*>()(binary->secondChild.get()));
+                break;
+            }
+
+            case(E_NonlinearExpressionTypes::Sum):
+            case(E_NonlinearExpressionTypes::Product):
+            {
+                auto general = std::static_pointer_cast<ExpressionGeneral>(expression);
+
+                for(auto& C : general->children)
+                {
+                    C = eliminate(C);
+                    combineHash(hash, std::hash<NonlinearExpression*>()(C.get()));
+                }
+
+                break;
+            }
+
+            default:
+            {
+                auto unary = std::static_pointer_cast<ExpressionUnary>(expression);
+                unary->child = eliminate(unary->child);
+
+                combineHash(hash, std::hash<NonlinearExpression*>()(unary->child.get()));
+                break;
+            }
+            }
+
+            auto& candidates = nodesWithHash[hash];
+            NonlinearExpressionPtr uniqueNode = expression;
+
+            for(auto& N : candidates)
+            {
+                if(*N == *expression)
+                {
+                    uniqueNode = N;
+                    break;
+                }
+            }
+
+            if(uniqueNode == expression)
+            {
+                candidates.push_back(expression);
+            }
+            else if(expression->getType() != E_NonlinearExpressionTypes::Constant
+                && expression->getType() != E_NonlinearExpressionTypes::Variable)
+            {
+                numberOfEliminatedNodes++;
+            }
+
+            uniqueNodes.emplace(expression.get(), uniqueNode);
+            return (uniqueNode);
+        }
+
+        // Only operations are counted, since shared constants and variables do not save any calculations
+        int numberOfEliminatedNodes = 0;
+
+    private:
+        static inline void combineHash(size_t& hash, size_t value)
+        {
+            hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        std::unordered_map<size_t, std::vector<NonlinearExpressionPtr>> nodesWithHash;
+
+        // The unique node for each node that has been visited, so that shared nodes are only handled once
+        std::unordered_map<NonlinearExpression*, NonlinearExpressionPtr> uniqueNodes;
+    };
+}
+
+int eliminateCommonSubexpressions(ProblemPtr problem)
+{
+    CommonSubexpressionEliminator eliminator;
+
+    for(auto& C : problem->nonlinearConstraints)
+    {
+        if(C->properties.hasNonlinearExpression && C->nonlinearExpression)
+            C->nonlinearExpression = eliminator.eliminate(C->nonlinearExpression);
+    }
+
+    if(problem->objectiveFunction->properties.hasNonlinearExpression)
+    {
+        auto nonlinearObjective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(problem->objectiveFunction);
+
+        if(nonlinearObjective->nonlinearExpression)
+            nonlinearObjective->nonlinearExpression = eliminator.eliminate(nonlinearObjective->nonlinearExpression);
+    }
+
+    return (eliminator.numberOfEliminatedNodes);
+}
+
 NonlinearExpressionPtr copyNonlinearExpression(NonlinearExpression* expression, const ProblemPtr destination)
 {
     return copyNonlinearExpression(expression, destination.get());
@@ -329,27 +456,27 @@ NonlinearExpressionPtr copyNonlinearExpression(NonlinearExpression* expression,
         switch(numChildren)
         {
         case 0:
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         case 1:
             return copyNonlinearExpression(((ExpressionSum*)expression)->children[0].get(), destination);
         default:
             NonlinearExpressions terms;
             for(int i = 0; i < numChildren; i++)
                 terms.push_back(copyNonlinearExpression(((ExpressionSum*)expression)->children[i].get(), destination));
-            return std::make_shared<ExpressionSum>(terms);
+            return makeExpression<ExpressionSum>(terms);
         }
 
     case E_NonlinearExpressionTypes::Negate:
-        return std::make_shared<ExpressionNegate>(
+        return makeExpression<ExpressionNegate>(
             copyNonlinearExpression(((ExpressionNegate*)expression)->child.get(), destination));
 
     case E_NonlinearExpressionTypes::Divide:
-        return std::make_shared<ExpressionDivide>(
+        return makeExpression<ExpressionDivide>(
             copyNonlinearExpression(((ExpressionDivide*)expression)->firstChild.get(), destination),
             copyNonlinearExpression(((ExpressionDivide*)expression)->secondChild.get(), destination));
 
     case E_NonlinearExpressionTypes::Power:
-        return std::make_shared<ExpressionPower>(
+        return makeExpression<ExpressionPower>(
             copyNonlinearExpression(((ExpressionPower*)expression)->firstChild.get(), destination),
             copyNonlinearExpression(((ExpressionPower*)expression)->secondChild.get(), destination));
 
@@ -358,7 +485,7 @@ NonlinearExpressionPtr copyNonlinearExpression(NonlinearExpression* expression,
         switch(numChildren)
         {
         case 0:
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         case 1:
             return copyNonlinearExpression(((ExpressionProduct*)expression)->children[0].get(), destination);
         default:
@@ -366,58 +493,58 @@ NonlinearExpressionPtr copyNonlinearExpression(NonlinearExpression* expression,
             for(int i = 0; i < numChildren; i++)
                 factors.push_back(
                     copyNonlinearExpression(((ExpressionProduct*)expression)->children[i].get(), destination));
-            return std::make_shared<ExpressionProduct>(factors);
+            return makeExpression<ExpressionProduct>(factors);
         }
 
     case E_NonlinearExpressionTypes::Abs:
-        return std::make_shared<ExpressionAbs>(
+        return makeExpression<ExpressionAbs>(
             copyNonlinearExpression((((ExpressionAbs*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Square:
-        return std::make_shared<ExpressionSquare>(
+        return makeExpression<ExpressionSquare>(
             copyNonlinearExpression((((ExpressionSquare*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::SquareRoot:
-        return std::make_shared<ExpressionSquareRoot>(
+        return makeExpression<ExpressionSquareRoot>(
             copyNonlinearExpression((((ExpressionSquareRoot*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Invert:
-        return std::make_shared<ExpressionInvert>(
+        return makeExpression<ExpressionInvert>(
             copyNonlinearExpression((((ExpressionInvert*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Log:
-        return std::make_shared<ExpressionLog>(
+        return makeExpression<ExpressionLog>(
             copyNonlinearExpression((((ExpressionLog*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Exp:
-        return std::make_shared<ExpressionExp>(
+        return makeExpression<ExpressionExp>(
             copyNonlinearExpression((((ExpressionExp*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Sin:
-        return std::make_shared<ExpressionSin>(
+        return makeExpression<ExpressionSin>(
             copyNonlinearExpression((((ExpressionSin*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Cos:
-        return std::make_shared<ExpressionCos>(
+        return makeExpression<ExpressionCos>(
             copyNonlinearExpression((((ExpressionCos*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Tan:
-        return std::make_shared<ExpressionTan>(
+        return makeExpression<ExpressionTan>(
             copyNonlinearExpression((((ExpressionTan*)expression)->child).get(), destination));
 
     case E_NonlinearExpressionTypes::Constant:
-        return std::make_shared<ExpressionConstant>((((ExpressionConstant*)expression)->constant));
+        return makeExpression<ExpressionConstant>((((ExpressionConstant*)expression)->constant));
 
     case E_NonlinearExpressionTypes::Variable:
     {
         if(destination == nullptr)
         {
-            return std::make_shared<ExpressionVariable>(((ExpressionVariable*)expression)->variable);
+            return makeExpression<ExpressionVariable>(((ExpressionVariable*)expression)->variable);
         }
         else
         {
             int variableIndex = ((ExpressionVariable*)expression)->variable->index;
-            return std::make_shared<ExpressionVariable>(destination->getVariable(variableIndex));
+            return makeExpression<ExpressionVariable>(destination->getVariable(variableIndex));
         }
     }
     default:
@@ -79,12 +79,12 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionNegat
                 else if(T->getType() == E_NonlinearExpressionTypes::Product)
                 {
                     std::dynamic_pointer_cast<ExpressionProduct>(T)->children.add(
-                        std::make_shared<ExpressionConstant>(-1.0));
+                        makeExpression<ExpressionConstant>(-1.0));
                     T = simplify(T);
                 }
                 else
                 {
-                    T = std::make_shared<ExpressionNegate>(T);
+                    T = makeExpression<ExpressionNegate>(T);
                 }
             }
 
@@ -100,10 +100,10 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionNegat
         {
             auto variable = std::dynamic_pointer_cast<ExpressionVariable>(expression->child)->variable;
 
-            auto product = std::make_shared<ExpressionProduct>();
+            auto product = makeExpression<ExpressionProduct>();
 
-            product->children.add(std::make_shared<ExpressionConstant>(-1.0));
-            product->children.add(std::make_shared<ExpressionVariable>(variable));
+            product->children.add(makeExpression<ExpressionConstant>(-1.0));
+            product->children.add(makeExpression<ExpressionVariable>(variable));
 
             return (product);
         }
@@ -111,7 +111,7 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionNegat
         {
             auto product = std::dynamic_pointer_cast<ExpressionProduct>(expression->child);
 
-            product->children.add(std::make_shared<ExpressionConstant>(-1.0));
+            product->children.add(makeExpression<ExpressionConstant>(-1.0));
 
             return (simplify(expression->child));
         }
@@ -333,10 +333,10 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionDivid
     }
 
     if(firstChildIsConstant && secondChildIsConstant)
-        return (std::make_shared<ExpressionConstant>(firstChildConstant / secondChildConstant));
+        return (makeExpression<ExpressionConstant>(firstChildConstant / secondChildConstant));
 
     if(firstChildIsConstant && firstChildConstant == 1.0)
-        return (std::make_shared<ExpressionInvert>(secondChild));
+        return (makeExpression<ExpressionInvert>(secondChild));
 
     if(secondChildIsConstant && secondChildConstant == 1.0)
         return (firstChild);
@@ -351,7 +351,7 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionDivid
             auto power = std::dynamic_pointer_cast<ExpressionConstant>(child->secondChild);
             power->constant *= -1.0;
 
-            return (std::make_shared<ExpressionProduct>(firstChild, secondChild));
+            return (makeExpression<ExpressionProduct>(firstChild, secondChild));
         }
     }
     else if(secondChild->getType() == E_NonlinearExpressionTypes::Square)
@@ -360,12 +360,12 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionDivid
 
         if(square->child->getType() == E_NonlinearExpressionTypes::Variable)
         {
-            return (std::make_shared<ExpressionProduct>(firstChild,
-                std::make_shared<ExpressionPower>(square->child, std::make_shared<ExpressionConstant>(-2.0))));
+            return (makeExpression<ExpressionProduct>(firstChild,
+                makeExpression<ExpressionPower>(square->child, makeExpression<ExpressionConstant>(-2.0))));
         }
     }
 
-    return (std::make_shared<ExpressionDivide>(firstChild, secondChild));
+    return (makeExpression<ExpressionDivide>(firstChild, secondChild));
 }
 
 inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionPower> expression)
@@ -391,26 +391,26 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionPower
     }
 
     if(firstChildIsConstant && secondChildIsConstant)
-        return (std::make_shared<ExpressionConstant>(std::pow(firstChildConstant, secondChildConstant)));
+        return (makeExpression<ExpressionConstant>(std::pow(firstChildConstant, secondChildConstant)));
 
     if(firstChildIsConstant && firstChildConstant == 1.0)
-        return (std::make_shared<ExpressionConstant>(1.0));
+        return (makeExpression<ExpressionConstant>(1.0));
 
     if(firstChildIsConstant && firstChildConstant == 0.0)
-        return (std::make_shared<ExpressionConstant>(0.0));
+        return (makeExpression<ExpressionConstant>(0.0));
 
     if(secondChildIsConstant)
     {
         if(secondChildConstant == 0.0)
-            return (std::make_shared<ExpressionConstant>(1.0));
+            return (makeExpression<ExpressionConstant>(1.0));
         else if(secondChildConstant == 1.0)
             return (firstChild);
         else if(secondChildConstant == 2.0)
-            return (std::make_shared<ExpressionSquare>(firstChild));
+            return (makeExpression<ExpressionSquare>(firstChild));
         else if(secondChildConstant == 0.5)
-            return (std::make_shared<ExpressionSquareRoot>(firstChild));
+            return (makeExpression<ExpressionSquareRoot>(firstChild));
         else if(secondChildConstant == -1.0)
-            return (std::make_shared<ExpressionInvert>(firstChild));
+            return (makeExpression<ExpressionInvert>(firstChild));
     }
 
     // Extract constants in if first child is product and has a constant as its first child.
@@ -430,18 +430,18 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionPower
             children.add(*it);
         }
 
-        auto newProduct = std::make_shared<ExpressionProduct>();
+        auto newProduct = makeExpression<ExpressionProduct>();
 
         if(constant != 1.0)
-            newProduct->children.add(std::make_shared<ExpressionConstant>(std::pow(constant, power)));
+            newProduct->children.add(makeExpression<ExpressionConstant>(std::pow(constant, power)));
 
         newProduct->children.add(
-            std::make_shared<ExpressionPower>(std::make_shared<ExpressionProduct>(children), secondChild));
+            makeExpression<ExpressionPower>(makeExpression<ExpressionProduct>(children), secondChild));
 
         return (newProduct);
     }
 
-    return (std::make_shared<ExpressionPower>(firstChild, secondChild));
+    return (makeExpression<ExpressionPower>(firstChild, secondChild));
 }
 
 inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionSum> expression)
@@ -478,13 +478,13 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionSum>
         }
     }
 
-    auto sum = std::make_shared<ExpressionSum>();
+    auto sum = makeExpression<ExpressionSum>();
 
     if(constant != 0.0)
-        sum->children.add(std::make_shared<ExpressionConstant>(constant));
+        sum->children.add(makeExpression<ExpressionConstant>(constant));
 
     if(children.size() == 0) // Everything has been simplified away
-        return (std::make_shared<ExpressionConstant>(0.0));
+        return (makeExpression<ExpressionConstant>(0.0));
 
     for(auto& C : children)
     {
@@ -511,7 +511,7 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionProdu
             constant *= std::dynamic_pointer_cast<ExpressionConstant>(C)->constant;
 
             if(constant == 0.0)
-                return (std::make_shared<ExpressionConstant>(0.0));
+                return (makeExpression<ExpressionConstant>(0.0));
         }
         else if(C->getType() == E_NonlinearExpressionTypes::Sum)
         {
@@ -526,7 +526,7 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionProdu
                     constant *= std::dynamic_pointer_cast<ExpressionConstant>(CC)->constant;
 
                     if(constant == 0.0)
-                        return (std::make_shared<ExpressionConstant>(0.0));
+                        return (makeExpression<ExpressionConstant>(0.0));
                 }
                 else
                 {
@@ -542,14 +542,14 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionProdu
 
     if(unaddedChildren.size() == 1)
     {
-        auto sum = std::make_shared<ExpressionSum>();
+        auto sum = makeExpression<ExpressionSum>();
 
         for(auto& T : std::dynamic_pointer_cast<ExpressionSum>(unaddedChildren[0])->children)
         {
-            auto newProduct = std::make_shared<ExpressionProduct>();
+            auto newProduct = makeExpression<ExpressionProduct>();
 
             if(constant != 1.0)
-                newProduct->children.add(std::make_shared<ExpressionConstant>(constant));
+                newProduct->children.add(makeExpression<ExpressionConstant>(constant));
 
             for(auto& C : children)
             {
@@ -564,10 +564,10 @@ inline NonlinearExpressionPtr simplifyExpression(std::shared_ptr<ExpressionProdu
         return (simplifyExpression(sum));
     }
 
-    auto product = std::make_shared<ExpressionProduct>();
+    auto product = makeExpression<ExpressionProduct>();
 
     if(constant != 1.0)
-        product->children.add(std::make_shared<ExpressionConstant>(constant));
+        product->children.add(makeExpression<ExpressionConstant>(constant));
 
     for(auto& C : children)
     {
@@ -1094,7 +1094,7 @@ inline std::tuple<LinearTerms, QuadraticTerms, MonomialTerms, SignomialTerms, No
         auto variable = std::dynamic_pointer_cast<ExpressionVariable>(expression);
         linearTerms.add(std::make_shared<LinearTerm>(1.0, variable->variable));
 
-        nonlinearExpression = std::make_shared<ExpressionConstant>(0.0);
+        nonlinearExpression = makeExpression<ExpressionConstant>(0.0);
     }
     else if(expression->getType() == E_NonlinearExpressionTypes::Square)
     {
@@ -1238,7 +1238,7 @@ inline std::tuple<LinearTerms, QuadraticTerms, MonomialTerms, SignomialTerms, No
 
         if(children.size() == 0)
             // The nonlinear expression has been fully extracted
-            nonlinearExpression = std::make_shared<ExpressionConstant>(0.0);
+            nonlinearExpression = makeExpression<ExpressionConstant>(0.0);
         else
         {
             std::dynamic_pointer_cast<ExpressionSum>(expression)->children = children;
@@ -1262,4 +1262,8 @@ inline std::tuple<LinearTerms, QuadraticTerms, MonomialTerms, SignomialTerms, No
 void simplifyNonlinearExpressions(
     ProblemPtr problem, bool extractMonomials, bool extractSignomials, bool extractQuadratics);
 
+// Makes identical subexpressions in the nonlinear constraints and objective share the same node, returns the number of
+// eliminated nodes
+int eliminateCommonSubexpressions(ProblemPtr problem);
+
 } // namespace SHOT
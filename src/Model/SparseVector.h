@@ -0,0 +1,179 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace SHOT
+{
+class Variable;
+
+// The elements in sparse vectors are sorted on the variable indices
+template <typename V> inline int getSparseElementOrder(const std::shared_ptr<V>& variable)
+{
+    return (variable->index);
+}
+
+template <typename V>
+inline std::pair<int, int> getSparseElementOrder(const std::pair<std::shared_ptr<V>, std::shared_ptr<V>>& variables)
+{
+    return (std::make_pair(variables.first->index, variables.second->index));
+}
+
+// A sparse vector with the elements stored contiguously and sorted on the keys. It has the same interface as the
+// std::map it replaces, but does not allocate memory for each element and keeps its storage when cleared
+template <typename K> class SparseVector : private std::vector<std::pair<K, double>>
+{
+private:
+    using Elements = std::vector<std::pair<K, double>>;
+
+    static inline bool isBefore(const std::pair<K, double>& element, const K& key)
+    {
+        return (getSparseElementOrder(element.first) < getSparseElementOrder(key));
+    }
+
+public:
+    using typename Elements::const_iterator;
+    using typename Elements::iterator;
+    using typename Elements::value_type;
+
+    using Elements::begin;
+    using Elements::capacity;
+    using Elements::clear;
+    using Elements::empty;
+    using Elements::end;
+    using Elements::erase;
+    using Elements::reserve;
+    using Elements::size;
+
+    SparseVector() = default;
+
+    inline iterator lower_bound(const K& key) { return (std::lower_bound(begin(), end(), key, isBefore)); }
+
+    inline const_iterator lower_bound(const K& key) const
+    {
+        return (std::lower_bound(begin(), end(), key, isBefore));
+    }
+
+    inline iterator find(const K& key)
+    {
+        auto element = lower_bound(key);
+
+        if(element != end() && getSparseElementOrder(element->first) == getSparseElementOrder(key))
+            return (element);
+
+        return (end());
+    }
+
+    inline const_iterator find(const K& key) const
+    {
+        auto element = lower_bound(key);
+
+        if(element != end() && getSparseElementOrder(element->first) == getSparseElementOrder(key))
+            return (element);
+
+        return (end());
+    }
+
+    inline size_t count(const K& key) const { return (find(key) != end() ? 1 : 0); }
+
+    // Inserts the element if the key does not exist, the second value is false if it already existed
+    inline std::pair<iterator, bool> emplace(const K& key, double value)
+    {
+        // Elements are often added in order, so check the last element first
+        if(Elements::empty() || getSparseElementOrder(Elements::back().first) < getSparseElementOrder(key))
+        {
+            Elements::emplace_back(key, value);
+            return (std::make_pair(end() - 1, true));
+        }
+
+        auto element = lower_bound(key);
+
+        if(getSparseElementOrder(element->first) == getSparseElementOrder(key))
+            return (std::make_pair(element, false));
+
+        return (std::make_pair(Elements::emplace(element, key, value), true));
+    }
+
+    inline std::pair<iterator, bool> insert(const value_type& element)
+    {
+        return (emplace(element.first, element.second));
+    }
+
+    inline double& operator[](const K& key) { return (emplace(key, 0.0).first->second); }
+
+    // Adds the value to the element with the key, or inserts the element if it does not exist
+    inline void add(const K& key, double value)
+    {
+        auto element = emplace(key, value);
+
+        if(!element.second)
+            element.first->second += value;
+    }
+
+    // Adds the elements of the other vector to this one, merging the sorted elements in linear time
+    void add(const SparseVector<K>& other)
+    {
+        if(other.empty())
+            return;
+
+        if(empty())
+        {
+            *this = other;
+            return;
+        }
+
+        thread_local Elements merged;
+        merged.clear();
+        merged.reserve(size() + other.size());
+
+        auto first = begin();
+        auto second = other.begin();
+
+        while(first != end() && second != other.end())
+        {
+            auto firstOrder = getSparseElementOrder(first->first);
+            auto secondOrder = getSparseElementOrder(second->first);
+
+            if(firstOrder < secondOrder)
+            {
+                merged.push_back(*first++);
+            }
+            else if(secondOrder < firstOrder)
+            {
+                merged.push_back(*second++);
+            }
+            else
+            {
+                merged.emplace_back(first->first, first->second + second->second);
+                first++;
+                second++;
+            }
+        }
+
+        merged.insert(merged.end(), first, end());
+        merged.insert(merged.end(), second, other.end());
+
+        // Swapping keeps the largest buffer in the thread local storage for the next merge
+        Elements::swap(merged);
+    }
+
+    // Removes all elements with the given value
+    inline void eraseValue(double value)
+    {
+        erase(std::remove_if(begin(), end(), [value](const value_type& element) { return (element.second == value); }),
+            end());
+    }
+};
+} // namespace SHOT
@@ -37,6 +37,10 @@ public:
 
     virtual Interval calculate(const IntervalVector& intervalVector) const = 0;
 
+    // Adds the value of the term in each of the points to values. The points are given as a column-major block, i.e.
+    // the value of the variable with index j in point i is points[j * numberOfPoints + i]
+    virtual void calculate(const double* points, size_t numberOfPoints, double* values) const = 0;
+
     virtual Interval getBounds();
 
     void inline takeOwnership(ProblemPtr owner) { ownerProblem = owner; }
@@ -72,6 +76,14 @@ public:
         return value;
     }
 
+    inline void calculate(const double* points, size_t numberOfPoints, double* values) const override
+    {
+        const double* variableValues = points + variable->index * numberOfPoints;
+
+        for(size_t i = 0; i < numberOfPoints; i++)
+            values[i] += coefficient * variableValues[i];
+    }
+
     E_Convexity getConvexity() const override { return E_Convexity::Linear; };
 
     E_Monotonicity getMonotonicity() const override
@@ -177,6 +189,15 @@ public:
         return value;
     }
 
+    // Adds the values of the terms in each of the points in the column-major block to values
+    void calculate(const double* points, size_t numberOfPoints, double* values) const
+    {
+        for(auto& TERM : *this)
+        {
+            TERM->calculate(points, numberOfPoints, values);
+        }
+    }
+
     Interval calculate(const IntervalVector& intervalVector) const
     {
         Interval value = Interval(0.0, 0.0);
@@ -280,6 +301,7 @@ public:
     SparseVariableVector calculateGradient([[maybe_unused]] const VectorDouble& point) const
     {
         SparseVariableVector gradient;
+        gradient.reserve(this->size());
 
         for(auto& T : (*this))
         {
@@ -345,6 +367,15 @@ public:
         return value;
     }
 
+    inline void calculate(const double* points, size_t numberOfPoints, double* values) const override
+    {
+        const double* firstValues = points + firstVariable->index * numberOfPoints;
+        const double* secondValues = points + secondVariable->index * numberOfPoints;
+
+        for(size_t i = 0; i < numberOfPoints; i++)
+            values[i] += coefficient * firstValues[i] * secondValues[i];
+    }
+
     E_Convexity getConvexity() const override
     {
         if(firstVariable == secondVariable)
@@ -458,6 +489,7 @@ public:
     SparseVariableVector calculateGradient(const VectorDouble& point) const
     {
         SparseVariableVector gradient;
+        gradient.reserve(2 * this->size());
 
         for(auto& T : (*this))
         {
@@ -564,6 +596,23 @@ public:
         return value;
     }
 
+    inline void calculate(const double* points, size_t numberOfPoints, double* values) const override
+    {
+        thread_local VectorDouble termValues;
+        termValues.assign(numberOfPoints, coefficient);
+
+        for(auto& V : variables)
+        {
+            const double* variableValues = points + V->index * numberOfPoints;
+
+            for(size_t i = 0; i < numberOfPoints; i++)
+                termValues[i] *= variableValues[i];
+        }
+
+        for(size_t i = 0; i < numberOfPoints; i++)
+            values[i] += termValues[i];
+    }
+
     inline E_Convexity getConvexity() const override { return E_Convexity::Unknown; };
 
     inline E_Monotonicity getMonotonicity() const override { return E_Monotonicity::Unknown; };
@@ -861,6 +910,23 @@ public:
         return value;
     }
 
+    inline void calculate(const double* points, size_t numberOfPoints, double* values) const override
+    {
+        thread_local VectorDouble termValues;
+        termValues.assign(numberOfPoints, coefficient);
+
+        for(auto& E : elements)
+        {
+            const double* variableValues = points + E->variable->index * numberOfPoints;
+
+            for(size_t i = 0; i < numberOfPoints; i++)
+                termValues[i] *= pow(variableValues[i], E->power);
+        }
+
+        for(size_t i = 0; i < numberOfPoints; i++)
+            values[i] += termValues[i];
+    }
+
     inline E_Convexity getConvexity() const override
     {
         size_t numberPositivePowers = 0;
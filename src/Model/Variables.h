@@ -13,6 +13,8 @@
 #include "../Enums.h"
 #include "../Structs.h"
 
+#include "SparseVector.h"
+
 #include <map>
 #include <memory>
 #include <ostream>
@@ -106,8 +108,8 @@ public:
 };
 
 using VariablePtr = std::shared_ptr<Variable>;
-using SparseVariableVector = std::map<VariablePtr, double>;
-using SparseVariableMatrix = std::map<std::pair<VariablePtr, VariablePtr>, double>;
+using SparseVariableVector = SparseVector<VariablePtr>;
+using SparseVariableMatrix = SparseVector<std::pair<VariablePtr, VariablePtr>>;
 
 class Variables : private std::vector<VariablePtr>
 {
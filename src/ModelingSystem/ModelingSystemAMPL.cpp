@@ -199,11 +199,11 @@ public:
         }
     }
 
-    NonlinearExpressionPtr OnNumber(double value) { return std::make_shared<ExpressionConstant>(value); }
+    NonlinearExpressionPtr OnNumber(double value) { return makeExpression<ExpressionConstant>(value); }
 
     NonlinearExpressionPtr OnVariableRef(int variableIndex)
     {
-        return std::make_shared<ExpressionVariable>(destination->getVariable(variableIndex));
+        return makeExpression<ExpressionVariable>(destination->getVariable(variableIndex));
     }
 
     NonlinearExpressionPtr OnUnary(mp::expr::Kind kind, NonlinearExpressionPtr child)
@@ -212,40 +212,40 @@ public:
         {
 
         case mp::expr::MINUS:
-            return std::make_shared<ExpressionNegate>(child);
+            return makeExpression<ExpressionNegate>(child);
 
         case mp::expr::ABS:
-            return std::make_shared<ExpressionAbs>(child);
+            return makeExpression<ExpressionAbs>(child);
 
         case mp::expr::POW2:
-            return std::make_shared<ExpressionSquare>(child);
+            return makeExpression<ExpressionSquare>(child);
 
         case mp::expr::SQRT:
-            return std::make_shared<ExpressionSquareRoot>(child);
+            return makeExpression<ExpressionSquareRoot>(child);
 
         case mp::expr::LOG:
-            return std::make_shared<ExpressionLog>(child);
+            return makeExpression<ExpressionLog>(child);
 
         case mp::expr::EXP:
-            return std::make_shared<ExpressionExp>(child);
+            return makeExpression<ExpressionExp>(child);
 
         case mp::expr::SIN:
-            return std::make_shared<ExpressionSin>(child);
+            return makeExpression<ExpressionSin>(child);
 
         case mp::expr::COS:
-            return std::make_shared<ExpressionCos>(child);
+            return makeExpression<ExpressionCos>(child);
 
         case mp::expr::TAN:
-            return std::make_shared<ExpressionTan>(child);
+            return makeExpression<ExpressionTan>(child);
 
         case mp::expr::ASIN:
-            return std::make_shared<ExpressionArcSin>(child);
+            return makeExpression<ExpressionArcSin>(child);
 
         case mp::expr::ACOS:
-            return std::make_shared<ExpressionArcCos>(child);
+            return makeExpression<ExpressionArcCos>(child);
 
         case mp::expr::ATAN:
-            return std::make_shared<ExpressionArcTan>(child);
+            return makeExpression<ExpressionArcTan>(child);
 
         default:
             throw OperationNotImplementedException(fmt::format("Error: Unsupported AMPL function {}", kind));
@@ -261,25 +261,25 @@ public:
         switch(kind)
         {
         case mp::expr::ADD:
-            return std::make_shared<ExpressionSum>(firstChild, secondChild);
+            return makeExpression<ExpressionSum>(firstChild, secondChild);
 
         case mp::expr::SUB:
-            return std::make_shared<ExpressionSum>(firstChild, std::make_shared<ExpressionNegate>(secondChild));
+            return makeExpression<ExpressionSum>(firstChild, makeExpression<ExpressionNegate>(secondChild));
 
         case mp::expr::MUL:
-            return std::make_shared<ExpressionProduct>(firstChild, secondChild);
+            return makeExpression<ExpressionProduct>(firstChild, secondChild);
 
         case mp::expr::DIV:
-            return std::make_shared<ExpressionDivide>(firstChild, secondChild);
+            return makeExpression<ExpressionDivide>(firstChild, secondChild);
 
         case mp::expr::POW:
-            return std::make_shared<ExpressionPower>(firstChild, secondChild);
+            return makeExpression<ExpressionPower>(firstChild, secondChild);
 
         case mp::expr::POW_CONST_BASE:
-            return std::make_shared<ExpressionPower>(firstChild, secondChild);
+            return makeExpression<ExpressionPower>(firstChild, secondChild);
 
         case mp::expr::POW_CONST_EXP:
-            return std::make_shared<ExpressionPower>(firstChild, secondChild);
+            return makeExpression<ExpressionPower>(firstChild, secondChild);
 
         default:
             throw OperationNotImplementedException(fmt::format("Error: Unsupported AMPL function {}", kind));
@@ -299,7 +299,7 @@ public:
 
     NumericArgHandler BeginSum(int) { return NumericArgHandler(); }
 
-    NonlinearExpressionPtr EndSum(NumericArgHandler handler) { return std::make_shared<ExpressionSum>(handler.terms); }
+    NonlinearExpressionPtr EndSum(NumericArgHandler handler) { return makeExpression<ExpressionSum>(handler.terms); }
 
     void OnObj([[maybe_unused]] int objectiveIndex, mp::obj::Type type, NonlinearExpressionPtr nonlinearExpression)
     {
@@ -989,13 +989,13 @@ bool ModelingSystemGAMS::copyNonlinearExpressions(ProblemPtr destination)
                 if(objjacval == 1.0)
                 {
                     // scale by -1/objjacval = negate
-                    destinationExpression = std::make_shared<ExpressionNegate>(destinationExpression);
+                    destinationExpression = makeExpression<ExpressionNegate>(destinationExpression);
                 }
                 else if(objjacval != -1.0)
                 {
                     // scale by -1/objjacval
-                    destinationExpression = std::make_shared<ExpressionProduct>(
-                        std::make_shared<ExpressionConstant>(-1 / objjacval), destinationExpression);
+                    destinationExpression = makeExpression<ExpressionProduct>(
+                        makeExpression<ExpressionConstant>(-1 / objjacval), destinationExpression);
                 }
 
                 auto objective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(destination->objectiveFunction);
@@ -1080,25 +1080,25 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
         case nlPushV: // push variable
         {
             address = gmoGetjSolver(modelingObject, address);
-            stack.push_back(std::make_shared<ExpressionVariable>(destination->getVariable(address)));
+            stack.push_back(makeExpression<ExpressionVariable>(destination->getVariable(address)));
             break;
         }
 
         case nlPushI: // push constant
         {
-            stack.push_back(std::make_shared<ExpressionConstant>(constants[address]));
+            stack.push_back(makeExpression<ExpressionConstant>(constants[address]));
             break;
         }
 
         case nlPushZero: // push zero
         {
-            stack.push_back(std::make_shared<ExpressionConstant>(0.0));
+            stack.push_back(makeExpression<ExpressionConstant>(0.0));
             break;
         }
 
         case nlAdd: // add
         {
-            auto expression = std::make_shared<ExpressionSum>(stack.rbegin()[1], stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionSum>(stack.rbegin()[1], stack.rbegin()[0]);
             stack.pop_back();
             stack.pop_back();
             stack.push_back(expression);
@@ -1108,8 +1108,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
         case nlAddV: // add variable
         {
             address = gmoGetjSolver(modelingObject, address);
-            auto expression = std::make_shared<ExpressionSum>(
-                std::make_shared<ExpressionVariable>(destination->getVariable(address)), stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionSum>(
+                makeExpression<ExpressionVariable>(destination->getVariable(address)), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1117,8 +1117,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlAddI: // add immediate
         {
-            auto expression = std::make_shared<ExpressionSum>(
-                std::make_shared<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionSum>(
+                makeExpression<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1126,8 +1126,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlSub: // minus
         {
-            auto expression = std::make_shared<ExpressionSum>(
-                stack.rbegin()[1], std::make_shared<ExpressionNegate>(stack.rbegin()[0]));
+            auto expression = makeExpression<ExpressionSum>(
+                stack.rbegin()[1], makeExpression<ExpressionNegate>(stack.rbegin()[0]));
             stack.pop_back();
             stack.pop_back();
             stack.push_back(expression);
@@ -1137,9 +1137,9 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
         case nlSubV: // subtract variable
         {
             address = gmoGetjSolver(modelingObject, address);
-            auto expression = std::make_shared<ExpressionSum>(stack.rbegin()[0],
-                std::make_shared<ExpressionNegate>(
-                    std::make_shared<ExpressionVariable>(destination->getVariable(address))));
+            auto expression = makeExpression<ExpressionSum>(stack.rbegin()[0],
+                makeExpression<ExpressionNegate>(
+                    makeExpression<ExpressionVariable>(destination->getVariable(address))));
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1147,8 +1147,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlSubI: // subtract immediate
         {
-            auto expression = std::make_shared<ExpressionSum>(stack.rbegin()[0],
-                std::make_shared<ExpressionNegate>(std::make_shared<ExpressionConstant>(constants[address])));
+            auto expression = makeExpression<ExpressionSum>(stack.rbegin()[0],
+                makeExpression<ExpressionNegate>(makeExpression<ExpressionConstant>(constants[address])));
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1156,7 +1156,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlMul: // multiply
         {
-            auto expression = std::make_shared<ExpressionProduct>((stack.rbegin()[1]), (stack.rbegin()[0]));
+            auto expression = makeExpression<ExpressionProduct>((stack.rbegin()[1]), (stack.rbegin()[0]));
             stack.pop_back();
             stack.pop_back();
             stack.push_back(expression);
@@ -1166,8 +1166,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
         case nlMulV: // multiply variable
         {
             address = gmoGetjSolver(modelingObject, address);
-            auto expression = std::make_shared<ExpressionProduct>(
-                std::make_shared<ExpressionVariable>(destination->getVariable(address)), stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionProduct>(
+                makeExpression<ExpressionVariable>(destination->getVariable(address)), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1175,8 +1175,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlMulI: // multiply immediate
         {
-            auto expression = std::make_shared<ExpressionProduct>(
-                std::make_shared<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionProduct>(
+                makeExpression<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1184,11 +1184,11 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlMulIAdd: // multiply immediate and add
         {
-            auto expressionProduct = std::make_shared<ExpressionProduct>(
-                std::make_shared<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
+            auto expressionProduct = makeExpression<ExpressionProduct>(
+                makeExpression<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expressionProduct);
-            auto expressionSum = std::make_shared<ExpressionSum>(stack.rbegin()[1], stack.rbegin()[0]);
+            auto expressionSum = makeExpression<ExpressionSum>(stack.rbegin()[1], stack.rbegin()[0]);
             stack.pop_back();
             stack.pop_back();
             stack.push_back(expressionSum);
@@ -1197,7 +1197,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlDiv: // divide
         {
-            auto expression = std::make_shared<ExpressionDivide>(stack.rbegin()[1], stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionDivide>(stack.rbegin()[1], stack.rbegin()[0]);
             stack.pop_back();
             stack.pop_back();
             stack.push_back(expression);
@@ -1207,8 +1207,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
         case nlDivV: // divide variable
         {
             address = gmoGetjSolver(modelingObject, address);
-            auto expression = std::make_shared<ExpressionDivide>(
-                std::make_shared<ExpressionVariable>(destination->getVariable(address)), stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionDivide>(
+                makeExpression<ExpressionVariable>(destination->getVariable(address)), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1216,8 +1216,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlDivI: // divide immediate
         {
-            auto expression = std::make_shared<ExpressionDivide>(
-                std::make_shared<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionDivide>(
+                makeExpression<ExpressionConstant>(constants[address]), stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1225,7 +1225,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
         case nlUMin: // unary minus
         {
-            auto expression = std::make_shared<ExpressionNegate>(stack.rbegin()[0]);
+            auto expression = makeExpression<ExpressionNegate>(stack.rbegin()[0]);
             stack.pop_back();
             stack.push_back(expression);
             break;
@@ -1234,8 +1234,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
         case nlUMinV: // unary minus variable
         {
             address = gmoGetjSolver(modelingObject, address);
-            stack.push_back(std::make_shared<ExpressionNegate>(
-                std::make_shared<ExpressionVariable>(destination->getVariable(address))));
+            stack.push_back(makeExpression<ExpressionNegate>(
+                makeExpression<ExpressionVariable>(destination->getVariable(address))));
             break;
         }
 
@@ -1256,7 +1256,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnsqr:
             {
-                auto expression = std::make_shared<ExpressionSquare>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionSquare>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1264,7 +1264,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnexp:
             {
-                auto expression = std::make_shared<ExpressionExp>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionExp>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1272,7 +1272,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnlog:
             {
-                auto expression = std::make_shared<ExpressionLog>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionLog>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1281,8 +1281,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
             case fnlog10:
             {
                 auto expression
-                    = std::make_shared<ExpressionProduct>(std::make_shared<ExpressionConstant>(1.0 / log(10.0)),
-                        std::make_shared<ExpressionLog>(stack.rbegin()[0]));
+                    = makeExpression<ExpressionProduct>(makeExpression<ExpressionConstant>(1.0 / log(10.0)),
+                        makeExpression<ExpressionLog>(stack.rbegin()[0]));
 
                 stack.pop_back();
                 stack.push_back(expression);
@@ -1292,8 +1292,8 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
             case fnlog2:
             {
                 auto expression
-                    = std::make_shared<ExpressionProduct>(std::make_shared<ExpressionConstant>(1.0 / log(2.0)),
-                        std::make_shared<ExpressionLog>(stack.rbegin()[0]));
+                    = makeExpression<ExpressionProduct>(makeExpression<ExpressionConstant>(1.0 / log(2.0)),
+                        makeExpression<ExpressionLog>(stack.rbegin()[0]));
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1301,7 +1301,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnsqrt:
             {
-                auto expression = std::make_shared<ExpressionSquareRoot>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionSquareRoot>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1309,7 +1309,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnabs:
             {
-                auto expression = std::make_shared<ExpressionAbs>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionAbs>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1317,7 +1317,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fncos:
             {
-                auto expression = std::make_shared<ExpressionCos>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionCos>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1325,7 +1325,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnsin:
             {
-                auto expression = std::make_shared<ExpressionSin>(stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionSin>(stack.rbegin()[0]);
                 stack.pop_back();
                 stack.push_back(expression);
                 break;
@@ -1336,7 +1336,7 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
             case fncvpower: // constant ^ x
             case fnvcpower: // x ^ constant
             {
-                auto expression = std::make_shared<ExpressionPower>(stack.rbegin()[1], stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionPower>(stack.rbegin()[1], stack.rbegin()[0]);
                 stack.pop_back();
                 stack.pop_back();
                 stack.push_back(expression);
@@ -1345,13 +1345,13 @@ NonlinearExpressionPtr ModelingSystemGAMS::parseGamsInstructions(int codelen, /*
 
             case fnpi:
             {
-                stack.push_back(std::make_shared<ExpressionConstant>(3.14159265));
+                stack.push_back(makeExpression<ExpressionConstant>(3.14159265));
                 break;
             }
 
             case fndiv:
             {
-                auto expression = std::make_shared<ExpressionDivide>(stack.rbegin()[1], stack.rbegin()[0]);
+                auto expression = makeExpression<ExpressionDivide>(stack.rbegin()[1], stack.rbegin()[0]);
                 stack.pop_back();
                 stack.pop_back();
                 stack.push_back(expression);
@@ -583,85 +583,85 @@ NonlinearExpressionPtr ModelingSystemOS::convertOSNonlinearNode(OSnLNode* node,
     switch(node->inodeInt)
     {
     case OS_PLUS:
-        return std::make_shared<ExpressionSum>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
+        return makeExpression<ExpressionSum>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination));
 
     case OS_SUM:
         switch(node->inumberOfChildren)
         {
         case 0:
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         case 1:
             return convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination);
         default:
             NonlinearExpressions terms;
             for(i = 0; i < node->inumberOfChildren; i++)
                 terms.push_back(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[i]), destination));
-            return std::make_shared<ExpressionSum>(terms);
+            return makeExpression<ExpressionSum>(terms);
         }
 
     case OS_MINUS:
-        return std::make_shared<ExpressionSum>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
-            std::make_shared<ExpressionNegate>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination)));
+        return makeExpression<ExpressionSum>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
+            makeExpression<ExpressionNegate>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination)));
 
     case OS_NEGATE:
-        return std::make_shared<ExpressionNegate>(
+        return makeExpression<ExpressionNegate>(
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_TIMES:
-        return std::make_shared<ExpressionProduct>(
+        return makeExpression<ExpressionProduct>(
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination));
 
     case OS_DIVIDE:
-        return std::make_shared<ExpressionDivide>(
+        return makeExpression<ExpressionDivide>(
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination));
 
     case OS_POWER:
-        return std::make_shared<ExpressionPower>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
+        return makeExpression<ExpressionPower>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination));
 
     case OS_PRODUCT:
         switch(node->inumberOfChildren)
         {
         case 0:
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         case 1:
             return convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination);
         case 2:
-            return std::make_shared<ExpressionProduct>(
+            return makeExpression<ExpressionProduct>(
                 convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination),
                 convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[1]), destination));
         default:
             NonlinearExpressions factors;
             for(i = 0; i < node->inumberOfChildren; i++)
                 factors.push_back(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[i]), destination));
-            return std::make_shared<ExpressionProduct>(factors);
+            return makeExpression<ExpressionProduct>(factors);
         }
 
     case OS_ABS:
-        return std::make_shared<ExpressionAbs>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
+        return makeExpression<ExpressionAbs>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_SQUARE:
-        return std::make_shared<ExpressionSquare>(
+        return makeExpression<ExpressionSquare>(
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_SQRT:
-        return std::make_shared<ExpressionSquareRoot>(
+        return makeExpression<ExpressionSquareRoot>(
             convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_LN:
-        return std::make_shared<ExpressionLog>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
+        return makeExpression<ExpressionLog>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_EXP:
-        return std::make_shared<ExpressionExp>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
+        return makeExpression<ExpressionExp>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_SIN:
-        return std::make_shared<ExpressionSin>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
+        return makeExpression<ExpressionSin>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_COS:
-        return std::make_shared<ExpressionCos>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
+        return makeExpression<ExpressionCos>(convertOSNonlinearNode(((OSnLNode*)node->m_mChildren[0]), destination));
 
     case OS_MIN:
         throw OperationNotImplementedException("Error: Unsupported GAMS function min");
@@ -672,24 +672,24 @@ NonlinearExpressionPtr ModelingSystemOS::convertOSNonlinearNode(OSnLNode* node,
         break;
 
     case OS_NUMBER:
-        return std::make_shared<ExpressionConstant>(((OSnLNodeNumber*)node)->value);
+        return makeExpression<ExpressionConstant>(((OSnLNodeNumber*)node)->value);
 
     case OS_PI:
-        return std::make_shared<ExpressionConstant>(3.14159265);
+        return makeExpression<ExpressionConstant>(3.14159265);
 
     case OS_VARIABLE:
     {
         auto* varnode = (OSnLNodeVariable*)node;
         if(varnode->coef == 0.)
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         if(varnode->coef == 1.)
-            return std::make_shared<ExpressionVariable>(destination->getVariable(varnode->idx));
+            return makeExpression<ExpressionVariable>(destination->getVariable(varnode->idx));
         if(varnode->coef == -1.)
-            return std::make_shared<ExpressionNegate>(
-                std::make_shared<ExpressionVariable>(destination->getVariable(varnode->idx)));
+            return makeExpression<ExpressionNegate>(
+                makeExpression<ExpressionVariable>(destination->getVariable(varnode->idx)));
 
-        return std::make_shared<ExpressionProduct>(std::make_shared<ExpressionConstant>(varnode->coef),
-            std::make_shared<ExpressionVariable>(destination->getVariable(varnode->idx)));
+        return makeExpression<ExpressionProduct>(makeExpression<ExpressionConstant>(varnode->coef),
+            makeExpression<ExpressionVariable>(destination->getVariable(varnode->idx)));
     }
     default:
         throw OperationNotImplementedException(
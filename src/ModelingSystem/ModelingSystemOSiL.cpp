@@ -451,7 +451,7 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         auto firstChildNode = node->FirstChild();
         auto secondChildNode = firstChildNode->NextSibling();
 
-        return std::make_shared<ExpressionSum>(
+        return makeExpression<ExpressionSum>(
             convertNonlinearNode(firstChildNode, destination), convertNonlinearNode(secondChildNode, destination));
     }
     else if(expressionType.compare("sum") == 0)
@@ -464,11 +464,11 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         switch(terms.size())
         {
         case 0:
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         case 1:
             return terms[1];
         default:
-            return std::make_shared<ExpressionSum>(terms);
+            return makeExpression<ExpressionSum>(terms);
         }
     }
     else if(expressionType.compare("minus") == 0)
@@ -476,21 +476,21 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         auto firstChildNode = node->FirstChild();
         auto secondChildNode = firstChildNode->NextSibling();
 
-        return std::make_shared<ExpressionSum>(convertNonlinearNode(firstChildNode, destination),
-            std::make_shared<ExpressionNegate>(convertNonlinearNode(secondChildNode, destination)));
+        return makeExpression<ExpressionSum>(convertNonlinearNode(firstChildNode, destination),
+            makeExpression<ExpressionNegate>(convertNonlinearNode(secondChildNode, destination)));
     }
     else if(expressionType.compare("negate") == 0)
     {
         auto firstChildNode = node->FirstChild();
 
-        return std::make_shared<ExpressionNegate>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionNegate>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("times") == 0)
     {
         auto firstChildNode = node->FirstChild();
         auto secondChildNode = firstChildNode->NextSibling();
 
-        return std::make_shared<ExpressionProduct>(
+        return makeExpression<ExpressionProduct>(
             convertNonlinearNode(firstChildNode, destination), convertNonlinearNode(secondChildNode, destination));
     }
     else if(expressionType.compare("divide") == 0)
@@ -498,7 +498,7 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         auto firstChildNode = node->FirstChild();
         auto secondChildNode = firstChildNode->NextSibling();
 
-        return std::make_shared<ExpressionDivide>(
+        return makeExpression<ExpressionDivide>(
             convertNonlinearNode(firstChildNode, destination), convertNonlinearNode(secondChildNode, destination));
     }
     else if(expressionType.compare("power") == 0)
@@ -506,7 +506,7 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         auto firstChildNode = node->FirstChild();
         auto secondChildNode = firstChildNode->NextSibling();
 
-        return std::make_shared<ExpressionPower>(
+        return makeExpression<ExpressionPower>(
             convertNonlinearNode(firstChildNode, destination), convertNonlinearNode(secondChildNode, destination));
     }
     else if(expressionType.compare("product") == 0)
@@ -519,56 +519,56 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         switch(factors.size())
         {
         case 0:
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         case 1:
             return factors[1];
         default:
-            return std::make_shared<ExpressionProduct>(factors);
+            return makeExpression<ExpressionProduct>(factors);
         }
     }
     else if(expressionType.compare("abs") == 0)
     {
         auto firstChildNode = node->FirstChild();
 
-        return std::make_shared<ExpressionAbs>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionAbs>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("square") == 0)
     {
         auto firstChildNode = node->FirstChild();
-        return std::make_shared<ExpressionSquare>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionSquare>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("sqrt") == 0)
     {
         auto firstChildNode = node->FirstChild();
-        return std::make_shared<ExpressionSquareRoot>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionSquareRoot>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("ln") == 0)
     {
         auto firstChildNode = node->FirstChild();
-        return std::make_shared<ExpressionLog>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionLog>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("exp") == 0)
     {
         auto firstChildNode = node->FirstChild();
-        return std::make_shared<ExpressionExp>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionExp>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("sin") == 0)
     {
         auto firstChildNode = node->FirstChild();
-        return std::make_shared<ExpressionSin>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionSin>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("cos") == 0)
     {
         auto firstChildNode = node->FirstChild();
-        return std::make_shared<ExpressionCos>(convertNonlinearNode(firstChildNode, destination));
+        return makeExpression<ExpressionCos>(convertNonlinearNode(firstChildNode, destination));
     }
     else if(expressionType.compare("number") == 0)
     {
-        return std::make_shared<ExpressionConstant>(std::stod(node->ToElement()->Attribute("value")));
+        return makeExpression<ExpressionConstant>(std::stod(node->ToElement()->Attribute("value")));
     }
     else if(expressionType.compare("pi") == 0)
     {
-        return std::make_shared<ExpressionConstant>(3.14159265);
+        return makeExpression<ExpressionConstant>(3.14159265);
     }
     else if(expressionType.compare("variable") == 0)
     {
@@ -578,15 +578,15 @@ NonlinearExpressionPtr ModelingSystemOSiL::convertNonlinearNode(tinyxml2::XMLNod
         int variableIndex = std::stoi(node->ToElement()->Attribute("idx"));
 
         if(coefficient == 0.)
-            return std::make_shared<ExpressionConstant>(0.);
+            return makeExpression<ExpressionConstant>(0.);
         if(coefficient == 1.)
-            return std::make_shared<ExpressionVariable>(destination->getVariable(variableIndex));
+            return makeExpression<ExpressionVariable>(destination->getVariable(variableIndex));
         if(coefficient == -1.)
-            return std::make_shared<ExpressionNegate>(
-                std::make_shared<ExpressionVariable>(destination->getVariable(variableIndex)));
+            return makeExpression<ExpressionNegate>(
+                makeExpression<ExpressionVariable>(destination->getVariable(variableIndex)));
 
-        return std::make_shared<ExpressionProduct>(std::make_shared<ExpressionConstant>(coefficient),
-            std::make_shared<ExpressionVariable>(destination->getVariable(variableIndex)));
+        return makeExpression<ExpressionProduct>(makeExpression<ExpressionConstant>(coefficient),
+            makeExpression<ExpressionVariable>(destination->getVariable(variableIndex)));
     }
     else
     {
@@ -127,6 +127,9 @@ bool IpoptProblem::get_starting_point(Index n, bool init_x, Number* x, bool init
     assert(init_z == false);
     assert(init_lambda == false);
 
+    // A new solve is started, so nothing calculated in a previous solve is reused
+    currentPoint.clear();
+
     std::vector<bool> isInitialized(n, false);
 
     for(size_t k = 0; k < startingPointVariableIndexes.size(); k++)
@@ -224,105 +227,137 @@ bool IpoptProblem::get_starting_point(Index n, bool init_x, Number* x, bool init
     return (true);
 }
 
+void IpoptProblem::updatePoint(Index n, const Number* x, bool new_x)
+{
+    if(!new_x && currentPoint.size() == (size_t)n)
+        return;
+
+    currentPoint.assign(x, x + n);
+
+    isObjectiveValueCalculated = false;
+    areConstraintValuesCalculated = false;
+    areConstraintGradientsCalculated = false;
+}
+
 // Returns the value of the objective function
-bool IpoptProblem::eval_f(Index n, const Number* x, [[maybe_unused]] bool new_x, Number& obj_value)
+bool IpoptProblem::eval_f(Index n, const Number* x, bool new_x, Number& obj_value)
 {
-    VectorDouble vectorPoint(n);
+    updatePoint(n, x, new_x);
 
-    for(int i = 0; i < n; i++)
-        vectorPoint[i] = x[i];
+    if(!isObjectiveValueCalculated)
+    {
+        currentObjectiveValue = sourceProblem->objectiveFunction->calculateValue(currentPoint);
+        isObjectiveValueCalculated = true;
+    }
 
-    obj_value = sourceProblem->objectiveFunction->calculateValue(vectorPoint);
+    obj_value = currentObjectiveValue;
 
     return (true);
 }
 
 // Returns the gradient of the objective function
-bool IpoptProblem::eval_grad_f(Index n, const Number* x, [[maybe_unused]] bool new_x, Number* grad_f)
+bool IpoptProblem::eval_grad_f(Index n, const Number* x, bool new_x, Number* grad_f)
 {
-    VectorDouble vectorPoint(n);
-
-    for(int i = 0; i < n; i++)
-        vectorPoint[i] = x[i];
+    updatePoint(n, x, new_x);
 
     for(int i = 0; i < n; i++)
         grad_f[i] = 0.0;
 
-    for(auto& G : sourceProblem->objectiveFunction->calculateGradient(vectorPoint, false))
+    for(auto& G : sourceProblem->objectiveFunction->calculateGradient(currentPoint, false))
         grad_f[G.first->index] = G.second;
 
     return (true);
 }
 
 // Return the value of the constraints
-bool IpoptProblem::eval_g(Index n, const Number* x, [[maybe_unused]] bool new_x, Index m, Number* g)
+bool IpoptProblem::eval_g(Index n, const Number* x, bool new_x, Index m, Number* g)
 {
-    VectorDouble vectorPoint(n);
+    updatePoint(n, x, new_x);
 
-    for(int i = 0; i < n; i++)
-        vectorPoint[i] = x[i];
+    if(!areConstraintValuesCalculated)
+    {
+        currentConstraintValues.resize(m);
 
-    for(int i = 0; i < m; i++)
-        g[i] = 0.0;
+        for(int i = 0; i < m; i++)
+            currentConstraintValues[i] = sourceProblem->numericConstraints[i]->calculateFunctionValue(currentPoint);
+
+        areConstraintValuesCalculated = true;
+    }
 
     for(int i = 0; i < m; i++)
-        g[i] = sourceProblem->numericConstraints[i]->calculateFunctionValue(vectorPoint);
+        g[i] = currentConstraintValues[i];
 
     return (true);
 }
 
 // Return the structure or values of the jacobian
-bool IpoptProblem::eval_jac_g(Index n, const Number* x, [[maybe_unused]] bool new_x, [[maybe_unused]] Index m,
-    Index nele_jac, Index* iRow, Index* jCol, Number* values)
+bool IpoptProblem::eval_jac_g(Index n, const Number* x, bool new_x, [[maybe_unused]] Index m, Index nele_jac,
+    Index* iRow, Index* jCol, Number* values)
 {
     // The structure
     if(values == nullptr)
     {
         int counter = 0;
 
-        jacobianCounterPlacement.clear();
+        jacobianConstraintOffsets.clear();
+        jacobianVariableIndexes.clear();
+        jacobianVariableIndexes.reserve(nele_jac);
 
         for(auto& C : sourceProblem->numericConstraints)
         {
-            auto jacobian = C->getGradientSparsityPattern();
+            jacobianConstraintOffsets.push_back(counter);
+
+            for(auto& G : *C->getGradientSparsityPattern())
+                jacobianVariableIndexes.push_back(G->index);
 
-            for(auto& G : *jacobian)
+            std::sort(jacobianVariableIndexes.begin() + counter, jacobianVariableIndexes.end());
+
+            for(; counter < (int)jacobianVariableIndexes.size(); counter++)
             {
                 iRow[counter] = C->index;
-                jCol[counter] = G->index;
-
-                jacobianCounterPlacement.emplace(std::make_pair(C->index, G->index), counter);
-                counter++;
+                jCol[counter] = jacobianVariableIndexes[counter];
             }
 
             assert(counter <= nele_jac);
         }
 
+        jacobianConstraintOffsets.push_back(counter);
+
         return (true);
     }
 
     // The values
 
-    VectorDouble vectorPoint(n);
+    updatePoint(n, x, new_x);
 
-    for(int i = 0; i < n; i++)
-        vectorPoint[i] = x[i];
+    if(!areConstraintGradientsCalculated)
+    {
+        // The gradients of all constraints are calculated together, so the nonlinear expressions are only
+        // differentiated once
+        currentConstraintGradients
+            = sourceProblem->calculateConstraintGradients(currentPoint, sourceProblem->numericConstraints, false);
+        areConstraintGradientsCalculated = true;
+    }
 
     for(int i = 0; i < nele_jac; i++)
         values[i] = 0.0;
 
-    for(auto& C : sourceProblem->numericConstraints)
+    for(size_t i = 0; i < currentConstraintGradients.size(); i++)
     {
-        auto jacobian = C->calculateGradient(vectorPoint, false);
+        auto first = jacobianVariableIndexes.begin() + jacobianConstraintOffsets[i];
+        auto last = jacobianVariableIndexes.begin() + jacobianConstraintOffsets[i + 1];
 
-        for(auto& G : jacobian)
+        // Both the gradient and the Jacobian elements are sorted on the variable index
+        for(auto& G : currentConstraintGradients[i])
         {
-            int location = jacobianCounterPlacement[std::make_pair(C->index, G.first->index)];
+            first = std::lower_bound(first, last, G.first->index);
+
+            assert(first != last && *first == G.first->index);
 
-            values[location] += G.second;
+            if(first == last)
+                break;
 
-            assert(location < nele_jac);
-            assert(location >= 0);
+            values[first - jacobianVariableIndexes.begin()] += G.second;
         }
     }
 
@@ -330,15 +365,14 @@ bool IpoptProblem::eval_jac_g(Index n, const Number* x, [[maybe_unused]] bool ne
 }
 
 // Return the structure or values of the Hessian of the Langragian
-bool IpoptProblem::eval_h(Index n, const Number* x, [[maybe_unused]] bool new_x, Number obj_factor,
-    [[maybe_unused]] Index m, const Number* lambda, [[maybe_unused]] bool new_lambda, Index nele_hess, Index* iRow,
-    Index* jCol, Number* values)
+bool IpoptProblem::eval_h(Index n, const Number* x, bool new_x, Number obj_factor,
+    [[maybe_unused]] Index m, const Number* lambda, [[maybe_unused]] bool new_lambda, [[maybe_unused]] Index nele_hess,
+    Index* iRow, Index* jCol, Number* values)
 {
     // The structure
     if(values == nullptr)
     {
         int counter = 0;
-        lagrangianHessianCounterPlacement.clear();
 
         for(auto& E : *sourceProblem->getLagrangianHessianSparsityPattern())
         {
@@ -347,8 +381,6 @@ bool IpoptProblem::eval_h(Index n, const Number* x, [[maybe_unused]] bool new_x,
             iRow[counter] = E.first->index;
             jCol[counter] = E.second->index;
 
-            lagrangianHessianCounterPlacement.emplace(std::make_pair(E.first->index, E.second->index), counter);
-
             counter++;
         }
 
@@ -357,47 +389,12 @@ bool IpoptProblem::eval_h(Index n, const Number* x, [[maybe_unused]] bool new_x,
 
     // The values
 
-    VectorDouble vectorPoint(n);
-
-    for(int i = 0; i < n; i++)
-        vectorPoint[i] = x[i];
-
-    for(int i = 0; i < nele_hess; i++)
-        values[i] = 0.0;
-
-    if(obj_factor != 0.0)
-    {
-        for(auto& E : sourceProblem->objectiveFunction->calculateHessian(vectorPoint, false))
-        {
-            int location
-                = lagrangianHessianCounterPlacement[std::make_pair(E.first.first->index, E.first.second->index)];
+    updatePoint(n, x, new_x);
 
-            assert(location < nele_hess);
-            assert(location >= 0);
+    assert((size_t)nele_hess == sourceProblem->getLagrangianHessianSparsityPattern()->size());
 
-            values[location] = obj_factor * E.second;
-        }
-    }
-
-    for(auto& C : sourceProblem->numericConstraints)
-    {
-        if(C->properties.classification == E_ConstraintClassification::Linear)
-            continue;
-
-        if(lambda[C->index] == 0.0)
-            continue;
-
-        for(auto& E : C->calculateHessian(vectorPoint, false))
-        {
-            int location
-                = lagrangianHessianCounterPlacement[std::make_pair(E.first.first->index, E.first.second->index)];
-
-            assert(location < nele_hess);
-            assert(location >= 0);
-
-            values[location] += lambda[C->index] * E.second;
-        }
-    }
+    // The values are written in the same order as the structure above
+    sourceProblem->calculateLagrangianHessian(currentPoint, obj_factor, lambda, values);
 
     return (true);
 }
@@ -110,8 +110,23 @@ private:
 
     ProblemPtr sourceProblem;
 
-    std::map<std::pair<int, int>, int> lagrangianHessianCounterPlacement;
-    std::map<std::pair<int, int>, int> jacobianCounterPlacement;
+    // The point of the last call and the function values and derivatives calculated in it, these are only updated
+    // when Ipopt passes a new point
+    VectorDouble currentPoint;
+    double currentObjectiveValue = 0.0;
+    VectorDouble currentConstraintValues;
+    std::vector<SparseVariableVector> currentConstraintGradients;
+
+    bool isObjectiveValueCalculated = false;
+    bool areConstraintValuesCalculated = false;
+    bool areConstraintGradientsCalculated = false;
+
+    // The elements of the Jacobian are stored constraint by constraint, sorted on the variable index, so the elements
+    // of constraint i are in positions jacobianConstraintOffsets[i] to jacobianConstraintOffsets[i + 1] - 1
+    VectorInteger jacobianConstraintOffsets;
+    VectorInteger jacobianVariableIndexes;
+
+    void updatePoint(Ipopt::Index n, const Ipopt::Number* x, bool new_x);
 };
 
 class NLPSolverIpoptBase : virtual public INLPSolver
@@ -41,7 +41,7 @@ public:
 
 private:
     std::shared_ptr<spdlog::sinks::sink> consoleSink;
-    std::shared_ptr<spdlog::sinks::basic_file_sink_st> fileSink;
+    std::shared_ptr<spdlog::sinks::basic_file_sink_mt> fileSink;
 
     std::shared_ptr<spdlog::logger> logger;
 };
@@ -57,7 +57,7 @@ void PrimalSolver::addPrimalSolutionCandidates(std::vector<VectorDouble> pts, E_
     }
 }
 
-void PrimalSolver::addPrimalSolutionCandidate(SolutionPoint pt, E_PrimalSolutionSource source)
+void PrimalSolver::addPrimalSolutionCandidate(const SolutionPoint& pt, E_PrimalSolutionSource source)
 {
     PrimalSolution sol;
 
@@ -71,7 +71,7 @@ void PrimalSolver::addPrimalSolutionCandidate(SolutionPoint pt, E_PrimalSolution
     this->checkPrimalSolutionCandidates();
 }
 
-void PrimalSolver::addPrimalSolutionCandidates(std::vector<SolutionPoint> pts, E_PrimalSolutionSource source)
+void PrimalSolver::addPrimalSolutionCandidates(const std::vector<SolutionPoint>& pts, E_PrimalSolutionSource source)
 {
     for(auto& PT : pts)
     {
@@ -30,8 +30,8 @@ public:
     void addPrimalSolutionCandidate(VectorDouble pt, E_PrimalSolutionSource source, int iter);
     void addPrimalSolutionCandidates(std::vector<VectorDouble> pts, E_PrimalSolutionSource source, int iter);
 
-    void addPrimalSolutionCandidate(SolutionPoint pt, E_PrimalSolutionSource source);
-    void addPrimalSolutionCandidates(std::vector<SolutionPoint> pts, E_PrimalSolutionSource source);
+    void addPrimalSolutionCandidate(const SolutionPoint& pt, E_PrimalSolutionSource source);
+    void addPrimalSolutionCandidates(const std::vector<SolutionPoint>& pts, E_PrimalSolutionSource source);
 
     void checkPrimalSolutionCandidates();
 
@@ -183,6 +183,16 @@ void Report::outputIterationDetail(int iterationNumber, std::string iterationDes
         nodes << "\r\n";
 
         env->output->outputDebug(nodes.str());
+
+        auto currIter = env->results->getCurrentIteration();
+
+        if(currIter->numberOfRootsearches > 0)
+        {
+            env->output->outputDebug(fmt::format("        Root searches: {} ({} warm started). Function evaluations: "
+                                                 "{} ({} saved compared to bisection).",
+                currIter->numberOfRootsearches, currIter->numberOfWarmStartedRootsearches,
+                currIter->numberOfRootsearchFunctionEvaluations, currIter->numberOfRootsearchFunctionEvaluationsSaved));
+        }
     }
     catch(...)
     {
@@ -809,6 +819,26 @@ void Report::outputProblemInstanceReport()
                    << "\r\n";
     }
 
+    if(env->problem->properties.numberOfEliminatedExpressionNodes > 0
+        || env->reformulatedProblem->properties.numberOfEliminatedExpressionNodes > 0)
+    {
+        report << "\r\n";
+
+        if(isReformulated)
+        {
+            report << fmt::format(" {:28s}{:<21d}{:d}", "Duplicate expression nodes:",
+                          env->problem->properties.numberOfEliminatedExpressionNodes,
+                          env->reformulatedProblem->properties.numberOfEliminatedExpressionNodes)
+                   << "\r\n";
+        }
+        else
+        {
+            report << fmt::format(" {:28s}{:<21d}", "Duplicate expression nodes:",
+                          env->problem->properties.numberOfEliminatedExpressionNodes)
+                   << "\r\n";
+        }
+    }
+
     env->output->outputInfo(report.str());
 }
 
@@ -1054,6 +1084,34 @@ void Report::outputSolutionReport()
 
     report << "\r\n";
 
+    if(env->solutionStatistics.numberOfDuplicateHyperplanesRejected > 0
+        || env->solutionStatistics.numberOfNearDuplicateHyperplanesRejected > 0)
+    {
+        report << fmt::format(" {:<48}{:d}", "Duplicate hyperplanes rejected:",
+                      env->solutionStatistics.numberOfDuplicateHyperplanesRejected)
+               << "\r\n";
+
+        if(env->solutionStatistics.numberOfNearDuplicateHyperplanesRejected > 0)
+        {
+            report << fmt::format(" {:<48}{:d}", "- near duplicates:",
+                          env->solutionStatistics.numberOfNearDuplicateHyperplanesRejected)
+                   << "\r\n";
+        }
+
+        report << "\r\n";
+    }
+
+    if(env->solutionStatistics.numberOfHyperplanesRemovedToCutPool > 0)
+    {
+        report << fmt::format(" {:<48}{:d}", "Inactive hyperplanes removed to the cut pool:",
+                      env->solutionStatistics.numberOfHyperplanesRemovedToCutPool)
+               << "\r\n";
+        report << fmt::format(" {:<48}{:d}", "- added back when violated:",
+                      env->solutionStatistics.numberOfHyperplanesAddedFromCutPool)
+               << "\r\n";
+        report << "\r\n";
+    }
+
     if(env->solutionStatistics.numberOfExploredNodes > 0)
     {
         report << " Number of explored nodes:                       ";
@@ -1089,6 +1147,43 @@ void Report::outputSolutionReport()
         report << "\r\n";
     }
 
+    if(env->solutionStatistics.numberOfRootsearches > 0)
+    {
+        std::string methodDesc;
+
+        switch(static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver")))
+        {
+        case(ES_RootsearchMethod::BoostTOMS748):
+            methodDesc = "Boost TOMS748";
+            break;
+        case(ES_RootsearchMethod::SafeguardedNewton):
+            methodDesc = "safeguarded Newton";
+            break;
+        default:
+            methodDesc = "Boost bisection";
+            break;
+        }
+
+        report << fmt::format(" {:<48}{:d} ({})", "Root searches performed:",
+                      env->solutionStatistics.numberOfRootsearches.load(), methodDesc)
+               << "\r\n";
+        report << fmt::format(" {:<48}{:d}", "- function evaluations:",
+                      env->solutionStatistics.numberOfRootsearchFunctionEvaluations.load())
+               << "\r\n";
+        report << fmt::format(" {:<48}{:d}", "- evaluations saved compared to bisection:",
+                      env->solutionStatistics.numberOfRootsearchFunctionEvaluationsSaved.load())
+               << "\r\n";
+
+        if(env->solutionStatistics.numberOfWarmStartedRootsearches > 0)
+        {
+            report << fmt::format(" {:<48}{:d}", "- warm started from the previous iteration:",
+                          env->solutionStatistics.numberOfWarmStartedRootsearches.load())
+                   << "\r\n";
+        }
+
+        report << "\r\n";
+    }
+
     if(env->results->hasPrimalSolution())
     {
         report << fmt::format(" {:<48}{:d}",
@@ -1137,13 +1232,21 @@ void Report::outputSolutionReport()
     }
 
     for(auto& T : env->timing->timers)
-    {
         T.stop();
+
+    // The timers are shown as a breakdown, where each timer is followed by the timers that are a part of it
+    for(auto I : env->timing->getTimerHierarchy())
+    {
+        auto& T = env->timing->timers[I];
         auto elapsed = T.elapsed();
 
         if(elapsed > 0)
         {
-            report << fmt::format(" {:<48}{:g}", T.description + ':', elapsed) << "\r\n";
+            int depth = env->timing->getTimerDepth(I);
+            auto description = (depth == 0) ? T.description : std::string(2 * depth - 1, ' ') + "- " + T.description;
+
+            report << fmt::format(" {:<48}{:<14g}{:d} calls", description + ':', elapsed, T.getNumberOfCalls())
+                   << "\r\n";
         }
     }
 
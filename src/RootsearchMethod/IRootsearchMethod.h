@@ -15,9 +15,23 @@
 #include "../Model/Constraints.h"
 #include "../Model/ObjectiveFunction.h"
 
+#include <optional>
+
 namespace SHOT
 {
 
+// Narrows the initial bracket of a root search to the surroundings of the boundary found in a previous search on a
+// similar segment. The parameter of the segment is 1 in the first (interior) point and 0 in the second point.
+struct RootsearchWarmStart
+{
+    std::optional<double> previousLambda;
+    double width = 0.1; // The width of the initial bracket around the previous boundary
+
+    // Set by the search: the boundary found, and whether it was inside the narrowed bracket
+    std::optional<double> lambda;
+    bool isWarmStarted = false;
+};
+
 class IRootsearchMethod
 {
 public:
@@ -29,6 +43,13 @@ public:
         double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints, bool addPrimalCandidate)
         = 0;
 
+    // As above, but the search starts from the bracket given by warmStart if it contains the boundary, and otherwise
+    // from the whole segment
+    virtual std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
+        double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints, bool addPrimalCandidate,
+        RootsearchWarmStart& warmStart)
+        = 0;
+
     virtual std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
         double lambdaTol, double constrTol, const NonlinearConstraints constraints, bool addPrimalCandidate)
         = 0;
@@ -37,6 +58,14 @@ public:
         double lambdaTol, double constrTol, const NonlinearObjectiveFunction* objectiveFunction)
         = 0;
 
+    // Finds the boundary of each of the constraints on the segment between the points in a single search, where the
+    // trial points are shared by the constraints. Returns the (interior, exterior) points for each constraint, or
+    // nothing if the constraint is violated in both points. There is one warm start for each constraint.
+    virtual std::vector<std::optional<std::pair<VectorDouble, VectorDouble>>> findZeros(const VectorDouble& ptA,
+        const VectorDouble& ptB, int Nmax, double lambdaTol, const std::vector<NumericConstraint*>& constraints,
+        std::vector<RootsearchWarmStart>& warmStarts)
+        = 0;
+
 protected:
     EnvironmentPtr env;
 };
@@ -18,66 +18,277 @@
 
 #include "boost/math/tools/roots.hpp"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
 namespace SHOT
 {
-std::vector<NumericConstraint*> activeConstraints;
-double lastActiveConstraintUpdateValue;
-
-Test::Test(EnvironmentPtr envPtr) : env(envPtr) {}
 
-Test::~Test()
+namespace
 {
-    firstPt.clear();
-    secondPt.clear();
-}
+    // Newton's method for a function with a sign change in [lower, upper], safeguarded by bisection: a bisection step
+    // is taken whenever the Newton step would leave the bracket or would not halve the previous step. The function is
+    // called as function(x, derivative) and returns the value. Returns the final bracket, and sets maxIterations to
+    // the number of function evaluations.
+    template <typename Function>
+    PairDouble findZeroSafeguardedNewton(
+        Function function, double lower, double upper, double tolerance, boost::uintmax_t& maxIterations)
+    {
+        boost::uintmax_t iterations = 0;
+
+        double lowerDerivative, upperDerivative;
 
-void Test::addActiveConstraint(NumericConstraint* constraint) { activeConstraints.push_back(constraint); }
+        double lowerValue = function(lower, lowerDerivative);
+        double upperValue = function(upper, upperDerivative);
+        iterations += 2;
 
-void Test::clearActiveConstraints() { activeConstraints.clear(); }
+        if(lowerValue == 0.0)
+        {
+            maxIterations = iterations;
+            return (PairDouble(lower, lower));
+        }
+
+        if(upperValue == 0.0)
+        {
+            maxIterations = iterations;
+            return (PairDouble(upper, upper));
+        }
 
-void Test::setActiveConstraints(const std::vector<NumericConstraint*>& constraints)
+        if((lowerValue > 0.0) == (upperValue > 0.0))
+            throw Exception("No change of sign in the root search interval");
+
+        // Start from the end point with the smallest value
+        bool startFromLower = std::abs(lowerValue) < std::abs(upperValue);
+        double x = startFromLower ? lower : upper;
+        double value = startFromLower ? lowerValue : upperValue;
+        double derivative = startFromLower ? lowerDerivative : upperDerivative;
+
+        double step = upper - lower;
+        double previousStep = step;
+
+        while(iterations < maxIterations && upper - lower > tolerance && std::nextafter(lower, upper) < upper)
+        {
+            double next = 0.5 * (lower + upper);
+
+            if(std::isfinite(derivative) && derivative != 0.0)
+            {
+                double newtonPoint = x - value / derivative;
+
+                if(newtonPoint > lower && newtonPoint < upper
+                    && std::abs(2.0 * value) <= std::abs(previousStep * derivative))
+                {
+                    next = newtonPoint;
+                }
+            }
+
+            previousStep = step;
+            step = next - x;
+
+            // Newton's method only approaches the root from one side, so when it has converged a point slightly past
+            // the root is used to also move the other end of the bracket
+            double minimumStep = std::max(0.5 * tolerance, 4.0 * DBL_EPSILON * std::abs(x));
+
+            if(std::abs(step) < minimumStep)
+            {
+                next = x + std::copysign(minimumStep, step);
+
+                if(!(next > lower && next < upper))
+                    next = 0.5 * (lower + upper);
+
+                step = next - x;
+            }
+
+            x = next;
+            value = function(x, derivative);
+            iterations++;
+
+            if(value == 0.0)
+            {
+                lower = x;
+                upper = x;
+                break;
+            }
+
+            if((value > 0.0) == (lowerValue > 0.0))
+            {
+                lower = x;
+                lowerValue = value;
+            }
+            else
+            {
+                upper = x;
+            }
+        }
+
+        maxIterations = iterations;
+        return (PairDouble(lower, upper));
+    }
+
+    // Adds the indices of the variables the value of the constraint depends on
+    void appendConstraintVariables(NumericConstraint* constraint, std::vector<int>& variableIndices)
+    {
+        for(auto& V : *constraint->getGradientSparsityPattern())
+            variableIndices.push_back(V->index);
+
+        // The gradient sparsity pattern of an expression might not include variables with zero derivatives
+        if(auto nonlinearConstraint = dynamic_cast<NonlinearConstraint*>(constraint))
+        {
+            for(auto& V : nonlinearConstraint->variablesInNonlinearExpression)
+                variableIndices.push_back(V->index);
+        }
+    }
+
+    // The bracket of the boundary of one of the constraints in a simultaneous root search, the values in the ends have
+    // different signs
+    struct ConstraintBracket
+    {
+        double lower = 0.0;
+        double upper = 1.0;
+        double lowerValue = 0.0;
+        double upperValue = 0.0;
+
+        int retainedEnd = 0; // The end kept in the last update: -1 for lower and 1 for upper
+        int numberOfFunctionEvaluations = 0;
+        bool isFinished = false;
+
+        // The next trial point using the Illinois variant of regula falsi, or the midpoint if it is not inside
+        double getTrialPoint() const
+        {
+            double x = (lower * upperValue - upper * lowerValue) / (upperValue - lowerValue);
+
+            if(!(x > lower && x < upper))
+                x = 0.5 * (lower + upper);
+
+            return (x);
+        }
+
+        void update(double x, double value, double tolerance, int maxIterations)
+        {
+            numberOfFunctionEvaluations++;
+
+            if(value == 0.0)
+            {
+                lower = x;
+                upper = x;
+            }
+            else if((value > 0.0) == (lowerValue > 0.0))
+            {
+                lower = x;
+                lowerValue = value;
+
+                // The same end kept twice, so its value is halved to move the next trial point towards it
+                if(retainedEnd == 1)
+                    upperValue *= 0.5;
+
+                retainedEnd = 1;
+            }
+            else
+            {
+                upper = x;
+                upperValue = value;
+
+                if(retainedEnd == -1)
+                    lowerValue *= 0.5;
+
+                retainedEnd = -1;
+            }
+
+            isFinished = (upper - lower <= tolerance || std::nextafter(lower, upper) >= upper
+                || numberOfFunctionEvaluations >= maxIterations);
+        }
+    };
+
+    // The number of function evaluations a bisection needs to reduce the interval [0, 1] to the tolerance
+    int getNumberOfBisectionEvaluations(double tolerance, int maxIterations)
+    {
+        int halvings = static_cast<int>(std::ceil(std::log2(1.0 / std::max(tolerance, DBL_EPSILON))));
+        return (std::min(2 + halvings, maxIterations));
+    }
+} // namespace
+void RootsearchConstraintContext::setActiveConstraints(std::vector<NumericConstraint*> constraints)
 {
-    clearActiveConstraints();
+    activeConstraints = std::move(constraints);
 
-    for(auto& C : constraints)
-        addActiveConstraint(C);
+    lineVariables.clear();
+
+    for(auto& C : activeConstraints)
+        appendConstraintVariables(C, lineVariables);
+
+    std::sort(lineVariables.begin(), lineVariables.end());
+    lineVariables.erase(std::unique(lineVariables.begin(), lineVariables.end()), lineVariables.end());
 }
 
-std::vector<NumericConstraint*> Test::getActiveConstraints() { return (activeConstraints); }
+void RootsearchConstraintContext::updatePoint(const double x)
+{
+    for(auto I : lineVariables)
+        ptNew[I] = x * firstPt[I] + (1 - x) * secondPt[I];
+}
 
-double Test::operator()(const double x)
+double RootsearchConstraintContext::calculateValue(const double x)
 {
-    auto length = firstPt.size();
-    VectorDouble ptNew(length);
+    numberOfFunctionEvaluations++;
 
-    for(size_t i = 0; i < length; i++)
+    updatePoint(x);
+
+    std::vector<NumericConstraint*> newActiveConstraints;
+
+    auto constraintValue = problem->getMaxNumericConstraintValue(ptNew, activeConstraints, newActiveConstraints);
+    double calculatedValue = constraintValue.normalizedValue;
+
+    if(!constraintValue.isFulfilled && calculatedValue <= lastActiveConstraintUpdateValue
+        && newActiveConstraints.size() < activeConstraints.size())
     {
-        ptNew.at(i) = x * firstPt.at(i) + (1 - x) * secondPt.at(i);
+        setActiveConstraints(std::move(newActiveConstraints));
+        lastActiveConstraintUpdateValue = calculatedValue;
     }
 
-    auto currentConstraints = getActiveConstraints();
+    return (calculatedValue);
+}
+
+double RootsearchConstraintContext::calculateValue(const double x, double& derivative)
+{
+    numberOfFunctionEvaluations++;
+
+    updatePoint(x);
+
+    // Same as Problem::getMaxNumericConstraintValue, but also keeps the derivative of the largest value
+    std::vector<NumericConstraint*> newActiveConstraints;
+    NumericConstraintValue constraintValue;
 
-    std::vector<NumericConstraint*> activeConstraints;
+    for(size_t i = 0; i < activeConstraints.size(); i++)
+    {
+        double functionDerivative;
+        double functionValue = activeConstraints[i]->calculateFunctionValue(ptNew, direction, functionDerivative);
+        auto tmpValue = activeConstraints[i]->getNumericValue(functionValue);
+
+        if(i == 0 || tmpValue.normalizedValue > constraintValue.normalizedValue)
+        {
+            constraintValue = tmpValue;
+            derivative = (tmpValue.normalizedRHSValue >= tmpValue.normalizedLHSValue) ? functionDerivative
+                                                                                      : -functionDerivative;
+        }
+
+        if(tmpValue.normalizedValue > 0)
+            newActiveConstraints.push_back(activeConstraints[i]);
+    }
 
-    auto constraintValue = problem->getMaxNumericConstraintValue(ptNew, currentConstraints, activeConstraints);
     double calculatedValue = constraintValue.normalizedValue;
 
     if(!constraintValue.isFulfilled && calculatedValue <= lastActiveConstraintUpdateValue
-        && activeConstraints.size() < currentConstraints.size())
+        && newActiveConstraints.size() < activeConstraints.size())
     {
-        setActiveConstraints(activeConstraints);
+        setActiveConstraints(std::move(newActiveConstraints));
         lastActiveConstraintUpdateValue = calculatedValue;
     }
 
     return (calculatedValue);
 }
 
-TestObjective::TestObjective(EnvironmentPtr envPtr) : env(envPtr) {}
-
-TestObjective::~TestObjective() = default;
-
-double TestObjective::operator()(const double x)
+double RootsearchObjectiveContext::calculateValue(const double x)
 {
+    numberOfFunctionEvaluations++;
+
     // Change the value of the auxiliary objective function variable
     double ptNew = x * firstPt + (1 - x) * secondPt;
 
@@ -86,13 +297,34 @@ double TestObjective::operator()(const double x)
     return (calculatedValue);
 }
 
+double RootsearchObjectiveContext::calculateValue(const double x, double& derivative)
+{
+    derivative = secondPt - firstPt;
+    return (calculateValue(x));
+}
+
 RootsearchMethodBoost::RootsearchMethodBoost(EnvironmentPtr envPtr) : env(envPtr)
 {
-    test = std::make_unique<Test>(env);
-    testObjective = std::make_unique<TestObjective>(env);
+    rootsearchMethod = env->settings->getSettingRef<int>("Rootsearch.Method", "Subsolver");
 }
 
-RootsearchMethodBoost::~RootsearchMethodBoost() { activeConstraints.clear(); }
+RootsearchMethodBoost::~RootsearchMethodBoost() = default;
+
+void RootsearchMethodBoost::updateStatistics(
+    int numberOfFunctionEvaluations, double tolerance, int maxIterations, bool isWarmStarted)
+{
+    env->solutionStatistics.numberOfRootsearches++;
+
+    if(isWarmStarted)
+        env->solutionStatistics.numberOfWarmStartedRootsearches++;
+    env->solutionStatistics.numberOfRootsearchFunctionEvaluations += numberOfFunctionEvaluations;
+
+    int numberOfSavedEvaluations
+        = getNumberOfBisectionEvaluations(tolerance, maxIterations) - numberOfFunctionEvaluations;
+
+    if(numberOfSavedEvaluations > 0)
+        env->solutionStatistics.numberOfRootsearchFunctionEvaluationsSaved += numberOfSavedEvaluations;
+}
 
 std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const VectorDouble& ptA, const VectorDouble& ptB,
     int Nmax, double lambdaTol, double constrTol, const NonlinearConstraints constraints,
@@ -110,9 +342,20 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
 }
 
 std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const VectorDouble& ptA, const VectorDouble& ptB,
-    int Nmax, double lambdaTol, [[maybe_unused]] double constrTol, const std::vector<NumericConstraint*> constraints,
+    int Nmax, double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints,
     bool addPrimalCandidate = true)
 {
+    RootsearchWarmStart warmStart;
+    return (findZero(ptA, ptB, Nmax, lambdaTol, constrTol, constraints, addPrimalCandidate, warmStart));
+}
+
+std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const VectorDouble& ptA, const VectorDouble& ptB,
+    int Nmax, double lambdaTol, [[maybe_unused]] double constrTol, const std::vector<NumericConstraint*> constraints,
+    bool addPrimalCandidate, RootsearchWarmStart& warmStart)
+{
+    warmStart.lambda.reset();
+    warmStart.isWarmStarted = false;
+
     if(ptA.size() != ptB.size())
     {
         env->output->outputError("     Root search error: sizes of points vary: " + std::to_string(ptA.size())
@@ -124,9 +367,11 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
         env->output->outputError("     No constraints selected for root search");
     }
 
+    RootsearchConstraintContext context;
+
     if(auto sharedProblem = constraints[0]->ownerProblem.lock())
     {
-        test->problem = sharedProblem.get();
+        context.problem = sharedProblem.get();
     }
 
     auto length = ptA.size();
@@ -135,25 +380,25 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
 
     boost::uintmax_t max_iter = Nmax;
 
-    test->firstPt = ptA;
-    test->secondPt = ptB;
+    context.firstPt = ptA;
+    context.secondPt = ptB;
 
     std::vector<NumericConstraint*> firstActiveConstraints;
     std::vector<NumericConstraint*> secondActiveConstraints;
 
-    test->valFirstPt
-        = test->problem->getMaxNumericConstraintValue(ptA, constraints, firstActiveConstraints).normalizedValue;
-    test->valSecondPt
-        = test->problem->getMaxNumericConstraintValue(ptB, constraints, secondActiveConstraints).normalizedValue;
+    context.valFirstPt
+        = context.problem->getMaxNumericConstraintValue(ptA, constraints, firstActiveConstraints).normalizedValue;
+    context.valSecondPt
+        = context.problem->getMaxNumericConstraintValue(ptB, constraints, secondActiveConstraints).normalizedValue;
 
-    if(test->valFirstPt > 0)
-        test->setActiveConstraints(firstActiveConstraints);
+    if(context.valFirstPt > 0)
+        context.setActiveConstraints(std::move(firstActiveConstraints));
     else
-        test->setActiveConstraints(secondActiveConstraints);
+        context.setActiveConstraints(std::move(secondActiveConstraints));
 
-    if(test->getActiveConstraints().size() == 0) // All constraints are fulfilled.
+    if(context.activeConstraints.size() == 0) // All constraints are fulfilled.
     {
-        if(test->valFirstPt > test->valSecondPt)
+        if(context.valFirstPt > context.valSecondPt)
         {
             std::pair<VectorDouble, VectorDouble> tmpPair(ptB, ptA);
 
@@ -165,21 +410,73 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
         return (tmpPair);
     }
 
-    int tempFEvals = env->solutionStatistics.numberOfFunctionEvalutions;
+    // The variables not in the active constraints keep the values of the second point in all trial points, and the
+    // active constraints can only be reduced during the search
+    context.ptNew = ptB;
+    context.direction.assign(length, 0.0);
+
+    for(auto I : context.lineVariables)
+        context.direction[I] = ptA[I] - ptB[I];
+
+    // The function object is copied by Boost, so it only refers to the state of this search
+    auto function = [&context](const double x) { return (context.calculateValue(x)); };
+
+    double lower = 0.0;
+    double upper = 1.0;
+    double lowerValue = 0.0;
+    double upperValue = 0.0;
+
+    if(warmStart.previousLambda)
+    {
+        double narrowedLower = std::max(0.0, *warmStart.previousLambda - 0.5 * warmStart.width);
+        double narrowedUpper = std::min(1.0, *warmStart.previousLambda + 0.5 * warmStart.width);
+
+        if(narrowedUpper - narrowedLower < 1.0)
+        {
+            double narrowedLowerValue = function(narrowedLower);
+            double narrowedUpperValue = function(narrowedUpper);
+
+            // Otherwise the boundary has moved outside the narrowed bracket, and the whole segment is searched
+            if((narrowedLowerValue > 0.0) != (narrowedUpperValue > 0.0))
+            {
+                lower = narrowedLower;
+                upper = narrowedUpper;
+                lowerValue = narrowedLowerValue;
+                upperValue = narrowedUpperValue;
+                warmStart.isWarmStarted = true;
+            }
+        }
+    }
 
     PairDouble r1;
+    auto method = static_cast<ES_RootsearchMethod>(rootsearchMethod.get());
 
-    if(static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver"))
-        == ES_RootsearchMethod::BoostTOMS748)
+    if(method == ES_RootsearchMethod::BoostTOMS748 && warmStart.isWarmStarted)
+    {
+        // The values in the end points of the narrowed bracket are already known
+        r1 = boost::math::tools::toms748_solve(
+            function, lower, upper, lowerValue, upperValue, TerminationCondition(lambdaTol), max_iter);
+    }
+    else if(method == ES_RootsearchMethod::BoostTOMS748)
     {
-        r1 = boost::math::tools::toms748_solve(*test, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+        r1 = boost::math::tools::toms748_solve(function, lower, upper, TerminationCondition(lambdaTol), max_iter);
+    }
+    else if(method == ES_RootsearchMethod::SafeguardedNewton)
+    {
+        auto functionWithDerivative
+            = [&context](const double x, double& derivative) { return (context.calculateValue(x, derivative)); };
+
+        r1 = findZeroSafeguardedNewton(functionWithDerivative, lower, upper, lambdaTol, max_iter);
     }
     else
     {
-        r1 = boost::math::tools::bisect(*test, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+        r1 = boost::math::tools::bisect(function, lower, upper, TerminationCondition(lambdaTol), max_iter);
     }
 
-    int resFVals = env->solutionStatistics.numberOfFunctionEvalutions - tempFEvals;
+    warmStart.lambda = 0.5 * (r1.first + r1.second);
+
+    int resFVals = context.numberOfFunctionEvaluations;
+    updateStatistics(resFVals, lambdaTol, Nmax, warmStart.isWarmStarted);
     if((int)max_iter == Nmax)
     {
         env->output->outputDebug(
@@ -197,7 +494,7 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
         ptNew2.at(i) = r1.second * ptA.at(i) + (1 - r1.second) * ptB.at(i);
     }
 
-    auto validNewPt = test->problem->areNonlinearConstraintsFulfilled(ptNew, 0);
+    auto validNewPt = context.problem->areNonlinearConstraintsFulfilled(ptNew, 0);
 
     if(!validNewPt) // ptNew Outside feasible region
     {
@@ -223,36 +520,199 @@ std::pair<VectorDouble, VectorDouble> RootsearchMethodBoost::findZero(const Vect
     }
 }
 
+std::vector<std::optional<std::pair<VectorDouble, VectorDouble>>> RootsearchMethodBoost::findZeros(
+    const VectorDouble& ptA, const VectorDouble& ptB, int Nmax, double lambdaTol,
+    const std::vector<NumericConstraint*>& constraints, std::vector<RootsearchWarmStart>& warmStarts)
+{
+    size_t numberOfConstraints = constraints.size();
+    std::vector<std::optional<std::pair<VectorDouble, VectorDouble>>> results(numberOfConstraints);
+
+    // As in findZero, x = 1 gives ptA and x = 0 gives ptB
+    std::vector<ConstraintBracket> brackets(numberOfConstraints);
+    std::vector<std::vector<int>> constraintVariables(numberOfConstraints);
+    std::vector<bool> isSearched(numberOfConstraints, false);
+    std::vector<int> numberOfEndPointEvaluations(numberOfConstraints, 2);
+
+    // The variables not in the constraints keep the values of ptB in all trial points
+    VectorDouble point = ptB;
+
+    auto calculateValue = [&](size_t k, double x) {
+        for(auto I : constraintVariables[k])
+            point[I] = x * ptA[I] + (1 - x) * ptB[I];
+
+        return (constraints[k]->calculateNumericValue(point).normalizedValue);
+    };
+
+    for(size_t k = 0; k < numberOfConstraints; k++)
+    {
+        auto& bracket = brackets[k];
+        auto& warmStart = warmStarts[k];
+
+        warmStart.lambda.reset();
+        warmStart.isWarmStarted = false;
+
+        bracket.lowerValue = constraints[k]->calculateNumericValue(ptB).normalizedValue;
+        bracket.upperValue = constraints[k]->calculateNumericValue(ptA).normalizedValue;
+
+        if(bracket.lowerValue <= 0.0 && bracket.upperValue <= 0.0)
+        {
+            // The constraint is fulfilled in both points, handled as in findZero
+            bracket.isFinished = true;
+
+            if(bracket.upperValue > bracket.lowerValue)
+                results[k] = std::make_pair(ptB, ptA);
+            else
+                results[k] = std::make_pair(ptA, ptB);
+        }
+        else if(bracket.lowerValue > 0.0 && bracket.upperValue > 0.0)
+        {
+            // No boundary on the segment
+            bracket.isFinished = true;
+        }
+        else
+        {
+            isSearched[k] = true;
+            appendConstraintVariables(constraints[k], constraintVariables[k]);
+
+            // A boundary in one of the end points
+            if(bracket.lowerValue == 0.0)
+            {
+                bracket.upper = 0.0;
+                bracket.isFinished = true;
+            }
+            else if(bracket.upperValue == 0.0)
+            {
+                bracket.lower = 1.0;
+                bracket.isFinished = true;
+            }
+            else if(warmStart.previousLambda)
+            {
+                double narrowedLower = std::max(0.0, *warmStart.previousLambda - 0.5 * warmStart.width);
+                double narrowedUpper = std::min(1.0, *warmStart.previousLambda + 0.5 * warmStart.width);
+
+                if(narrowedUpper - narrowedLower < 1.0)
+                {
+                    double narrowedLowerValue = calculateValue(k, narrowedLower);
+                    double narrowedUpperValue = calculateValue(k, narrowedUpper);
+                    numberOfEndPointEvaluations[k] += 2;
+
+                    if((narrowedLowerValue > 0.0) != (narrowedUpperValue > 0.0))
+                    {
+                        bracket.lower = narrowedLower;
+                        bracket.upper = narrowedUpper;
+                        bracket.lowerValue = narrowedLowerValue;
+                        bracket.upperValue = narrowedUpperValue;
+                        warmStart.isWarmStarted = true;
+                    }
+                }
+            }
+        }
+    }
+
+    int numberOfTrialPoints = 0;
+
+    while(true)
+    {
+        // The trial point is chosen for the first unfinished constraint, and used for all constraints with the point
+        // inside their brackets
+        auto firstBracket = std::find_if(
+            brackets.begin(), brackets.end(), [](const ConstraintBracket& B) { return (!B.isFinished); });
+
+        if(firstBracket == brackets.end())
+            break;
+
+        double x = firstBracket->getTrialPoint();
+        numberOfTrialPoints++;
+
+        for(size_t k = 0; k < numberOfConstraints; k++)
+        {
+            auto& bracket = brackets[k];
+
+            if(bracket.isFinished || !(x > bracket.lower && x < bracket.upper))
+                continue;
+
+            bracket.update(x, calculateValue(k, x), lambdaTol, Nmax);
+        }
+    }
+
+    int numberOfFunctionEvaluations = 0;
+    size_t length = ptA.size();
+
+    for(size_t k = 0; k < numberOfConstraints; k++)
+    {
+        if(!isSearched[k])
+            continue;
+
+        auto& bracket = brackets[k];
+
+        // The end of the bracket where the constraint is fulfilled is the interior point
+        double interiorX = (bracket.lowerValue <= 0.0) ? bracket.lower : bracket.upper;
+        double exteriorX = (bracket.lowerValue <= 0.0) ? bracket.upper : bracket.lower;
+
+        VectorDouble interiorPoint(length);
+        VectorDouble exteriorPoint(length);
+
+        for(size_t i = 0; i < length; i++)
+        {
+            interiorPoint[i] = interiorX * ptA[i] + (1 - interiorX) * ptB[i];
+            exteriorPoint[i] = exteriorX * ptA[i] + (1 - exteriorX) * ptB[i];
+        }
+
+        results[k] = std::make_pair(interiorPoint, exteriorPoint);
+        warmStarts[k].lambda = 0.5 * (bracket.lower + bracket.upper);
+
+        // The two end points are also evaluated in a separate root search
+        updateStatistics(numberOfEndPointEvaluations[k] + bracket.numberOfFunctionEvaluations, lambdaTol, Nmax,
+            warmStarts[k].isWarmStarted);
+        numberOfFunctionEvaluations += bracket.numberOfFunctionEvaluations;
+    }
+
+    env->output->outputTrace(fmt::format("     Simultaneous root search for {} constraints: {} trial points and {} "
+                                         "constraint evaluations.",
+        numberOfConstraints, numberOfTrialPoints, numberOfFunctionEvaluations));
+
+    return (results);
+}
+
 std::pair<double, double> RootsearchMethodBoost::findZero(const VectorDouble& pt, double objectiveLB,
     double objectiveUB, int Nmax, double lambdaTol, [[maybe_unused]] double constrTol,
     const NonlinearObjectiveFunction* objectiveFunction)
 {
-    testObjective->solutionPoint = pt;
-    testObjective->firstPt = objectiveLB;
-    testObjective->secondPt = objectiveUB;
+    RootsearchObjectiveContext context;
+
+    context.firstPt = objectiveLB;
+    context.secondPt = objectiveUB;
 
     if(auto sharedProblem = objectiveFunction->ownerProblem.lock())
     {
-        testObjective->cachedObjectiveValue = sharedProblem->objectiveFunction->calculateValue(pt);
+        context.cachedObjectiveValue = sharedProblem->objectiveFunction->calculateValue(pt);
     }
 
     boost::uintmax_t max_iter = Nmax;
 
-    int tempFEvals = env->solutionStatistics.numberOfFunctionEvalutions;
+    auto function = [&context](const double x) { return (context.calculateValue(x)); };
 
     PairDouble r1;
+    auto method = static_cast<ES_RootsearchMethod>(rootsearchMethod.get());
 
-    if(static_cast<ES_RootsearchMethod>(env->settings->getSetting<int>("Rootsearch.Method", "Subsolver"))
-        == ES_RootsearchMethod::BoostTOMS748)
+    if(method == ES_RootsearchMethod::BoostTOMS748)
+    {
+        r1 = boost::math::tools::toms748_solve(function, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+    }
+    else if(method == ES_RootsearchMethod::SafeguardedNewton)
     {
-        r1 = boost::math::tools::toms748_solve(*testObjective, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+        auto functionWithDerivative
+            = [&context](const double x, double& derivative) { return (context.calculateValue(x, derivative)); };
+
+        r1 = findZeroSafeguardedNewton(functionWithDerivative, 0.0, 1.0, lambdaTol, max_iter);
     }
     else
     {
-        r1 = boost::math::tools::bisect(*testObjective, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
+        r1 = boost::math::tools::bisect(function, 0.0, 1.0, TerminationCondition(lambdaTol), max_iter);
     }
 
-    int resFVals = env->solutionStatistics.numberOfFunctionEvalutions - tempFEvals;
+    int resFVals = context.numberOfFunctionEvaluations;
+    updateStatistics(resFVals, lambdaTol, Nmax, false);
     if((int)max_iter == Nmax)
     {
         env->output->outputDebug(
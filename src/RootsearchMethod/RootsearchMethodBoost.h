@@ -11,50 +11,58 @@
 #pragma once
 #include "IRootsearchMethod.h"
 #include "../Environment.h"
+#include "../Settings.h"
 
 namespace SHOT
 {
-class Test
+// The state of a root search for the constraints along the line between two points. Each call to findZero owns its
+// own instance, so that several root searches can be performed at the same time
+class RootsearchConstraintContext
 {
-private:
-    EnvironmentPtr env;
-
 public:
-    Problem* problem;
+    Problem* problem = nullptr;
 
     VectorDouble firstPt;
     VectorDouble secondPt;
+    VectorDouble direction; // firstPt - secondPt, i.e. the derivative of the point with respect to x
 
-    double valFirstPt;
-    double valSecondPt;
+    double valFirstPt = 0.0;
+    double valSecondPt = 0.0;
 
-    Test(EnvironmentPtr envPtr);
-    ~Test();
+    // The constraints considered in the function evaluations, reduced as the search proceeds
+    std::vector<NumericConstraint*> activeConstraints;
+    double lastActiveConstraintUpdateValue = 0.0;
 
-    void setActiveConstraints(const std::vector<NumericConstraint*>& constraints);
-    std::vector<NumericConstraint*> getActiveConstraints();
-    void clearActiveConstraints();
-    void addActiveConstraint(NumericConstraint* constraint);
+    // The trial point, where only the variables in the active constraints (lineVariables) are updated for each x
+    VectorDouble ptNew;
+    std::vector<int> lineVariables;
 
-    double operator()(const double x);
-};
+    int numberOfFunctionEvaluations = 0;
+
+    void setActiveConstraints(std::vector<NumericConstraint*> constraints);
+
+    double calculateValue(const double x);
+
+    // Also calculates the derivative with respect to x of the largest constraint value
+    double calculateValue(const double x, double& derivative);
 
-class TestObjective
-{
 private:
-    EnvironmentPtr env;
+    void updatePoint(const double x);
+};
 
+// The state of a root search for the objective function between two bounds
+class RootsearchObjectiveContext
+{
 public:
-    VectorDouble solutionPoint;
-    double cachedObjectiveValue;
+    double cachedObjectiveValue = 0.0;
 
-    double firstPt;
-    double secondPt;
+    double firstPt = 0.0;
+    double secondPt = 0.0;
 
-    TestObjective(EnvironmentPtr envPtr);
-    ~TestObjective();
+    int numberOfFunctionEvaluations = 0;
 
-    double operator()(const double x);
+    double calculateValue(const double x);
+    double calculateValue(const double x, double& derivative);
 };
 
 class TerminationCondition
@@ -80,12 +88,22 @@ public:
     std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
         double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints, bool addPrimalCandidate) override;
 
+    std::pair<VectorDouble, VectorDouble> findZero(const VectorDouble& ptA, const VectorDouble& ptB, int Nmax,
+        double lambdaTol, double constrTol, const std::vector<NumericConstraint*> constraints, bool addPrimalCandidate,
+        RootsearchWarmStart& warmStart) override;
+
     std::pair<double, double> findZero(const VectorDouble& pt, double objectiveLB, double objectiveUB, int Nmax,
         double lambdaTol, double constrTol, const NonlinearObjectiveFunction* objectiveFunction) override;
 
+    std::vector<std::optional<std::pair<VectorDouble, VectorDouble>>> findZeros(const VectorDouble& ptA,
+        const VectorDouble& ptB, int Nmax, double lambdaTol,
+        const std::vector<NumericConstraint*>& constraints, std::vector<RootsearchWarmStart>& warmStarts) override;
+
 private:
-    std::unique_ptr<Test> test;
-    std::unique_ptr<TestObjective> testObjective;
+    void updateStatistics(int numberOfFunctionEvaluations, double tolerance, int maxIterations, bool isWarmStarted);
+
     EnvironmentPtr env;
+
+    SettingRef<int> rootsearchMethod;
 };
 } // namespace SHOT
\ No newline at end of file
@@ -61,6 +61,21 @@ public:
     }
 };
 
+// A handle to the value of a setting, for reading settings in code that is called often. The setting is looked up once
+// when the handle is obtained with Settings::getSettingRef, after which reading the value is a single load. Since the
+// values are updated in place, the handle always gives the value set last with Settings::updateSetting.
+template <typename T> class SettingRef
+{
+public:
+    SettingRef() = default;
+    explicit SettingRef(const T* valuePtr) : value(valuePtr) {}
+
+    inline const T& get() const { return (*value); }
+
+private:
+    const T* value = nullptr;
+};
+
 class DllExport Settings
 {
 private:
@@ -68,40 +83,8 @@ private:
     void createBaseSetting(
         std::string name, std::string category, T value, std::string description, bool isPrivate = false);
 
-    using OutputPtr = std::shared_ptr<Output>;
-    OutputPtr output;
-
-    using PairString = std::pair<std::string, std::string>;
-    using PairDouble = std::pair<double, double>;
-    using VectorString = std::vector<std::string>;
-
-    std::map<PairString, std::string> stringSettings;
-    std::map<PairString, double> doubleSettings;
-    std::map<PairString, int> integerSettings;
-    std::map<PairString, bool> booleanSettings;
-
-    std::map<PairString, std::string> settingDescriptions;
-    std::map<PairString, E_SettingType> settingTypes;
-    std::map<PairString, bool> settingIsPrivate;
-    std::map<PairString, bool> settingIsDefaultValue;
-    std::map<PairString, PairDouble> settingBounds;
-    std::map<PairString, bool> settingEnums;
-
-    using TupleStringPairInt = std::tuple<std::string, std::string, int>;
-    std::map<TupleStringPairInt, std::string> enumDescriptions;
-
-public:
-    bool settingsInitialized = false;
-
-    Settings(OutputPtr outputPtr);
-
-    ~Settings();
-
-    template <typename T> void updateSetting(std::string name, std::string category, T value);
-
-    // template <typename T> T getSetting(std::string name, std::string category);
-
-    template <typename T> T getSetting(std::string name, std::string category)
+    // Returns a pointer to the stored value of the setting, which stays valid as long as the settings exist
+    template <typename T> T* findSetting(const std::string& name, const std::string& category)
     {
         // Check that setting is of the correct type
         using value_type[[maybe_unused]] = typename std::enable_if<std::is_same<std::string, T>::value
@@ -141,7 +124,50 @@ public:
             throw SettingKeyNotFoundException(name, category);
         }
 
-        return (value->second);
+        return (&value->second);
+    }
+
+    using OutputPtr = std::shared_ptr<Output>;
+    OutputPtr output;
+
+    using PairString = std::pair<std::string, std::string>;
+    using PairDouble = std::pair<double, double>;
+    using VectorString = std::vector<std::string>;
+
+    std::map<PairString, std::string> stringSettings;
+    std::map<PairString, double> doubleSettings;
+    std::map<PairString, int> integerSettings;
+    std::map<PairString, bool> booleanSettings;
+
+    std::map<PairString, std::string> settingDescriptions;
+    std::map<PairString, E_SettingType> settingTypes;
+    std::map<PairString, bool> settingIsPrivate;
+    std::map<PairString, bool> settingIsDefaultValue;
+    std::map<PairString, PairDouble> settingBounds;
+    std::map<PairString, bool> settingEnums;
+
+    using TupleStringPairInt = std::tuple<std::string, std::string, int>;
+    std::map<TupleStringPairInt, std::string> enumDescriptions;
+
+public:
+    bool settingsInitialized = false;
+
+    Settings(OutputPtr outputPtr);
+
+    ~Settings();
+
+    template <typename T> void updateSetting(std::string name, std::string category, T value);
+
+    // template <typename T> T getSetting(std::string name, std::string category);
+
+    template <typename T> T getSetting(std::string name, std::string category)
+    {
+        return (*findSetting<T>(name, category));
+    }
+
+    template <typename T> SettingRef<T> getSettingRef(std::string name, std::string category)
+    {
+        return (SettingRef<T>(findSetting<T>(name, category)));
     }
 
     void createSetting(
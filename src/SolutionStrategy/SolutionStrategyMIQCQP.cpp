@@ -72,12 +72,12 @@ SolutionStrategyMIQCQP::SolutionStrategyMIQCQP(EnvironmentPtr envPtr)
 {
     env = envPtr;
 
-    env->timing->createTimer("InteriorPointSearch", " - interior point search");
+    env->timing->createTimer("InteriorPointSearch", "interior point search", "Total");
 
-    env->timing->createTimer("DualStrategy", " - dual strategy");
-    env->timing->createTimer("DualProblemsDiscrete", "   - solving MIP problems");
+    env->timing->createTimer("DualStrategy", "dual strategy", "Total");
+    env->timing->createTimer("DualProblemsDiscrete", "solving MIP problems", "DualStrategy");
 
-    env->timing->createTimer("PrimalStrategy", " - primal strategy");
+    env->timing->createTimer("PrimalStrategy", "primal strategy", "Total");
 
     auto tFinalizeSolution = std::make_shared<TaskSequential>(env);
 
@@ -51,6 +51,7 @@
 #include "../Tasks/TaskSelectHyperplanePointsESH.h"
 #include "../Tasks/TaskSelectHyperplanePointsECP.h"
 #include "../Tasks/TaskAddHyperplanes.h"
+#include "../Tasks/TaskUpdateCutPool.h"
 #include "../Tasks/TaskAddPrimalReductionCut.h"
 #include "../Tasks/TaskCheckMaxNumberOfPrimalReductionCuts.h"
 
@@ -79,18 +80,18 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
 {
     env = envPtr;
 
-    env->timing->createTimer("InteriorPointSearch", " - interior point search");
+    env->timing->createTimer("InteriorPointSearch", "interior point search", "Total");
 
-    env->timing->createTimer("DualStrategy", " - dual strategy");
-    env->timing->createTimer("DualProblemsRelaxed", "   - solving relaxed problems");
-    env->timing->createTimer("DualProblemsIntegerFixed", "   - solving integer-fixed problems");
-    env->timing->createTimer("DualProblemsDiscrete", "   - solving MIP problems");
-    env->timing->createTimer("DualCutGenerationRootSearch", "   - root search for constraint cuts");
-    env->timing->createTimer("DualObjectiveRootSearch", "   - root search for objective cut");
+    env->timing->createTimer("DualStrategy", "dual strategy", "Total");
+    env->timing->createTimer("DualProblemsRelaxed", "solving relaxed problems", "DualStrategy");
+    env->timing->createTimer("DualProblemsIntegerFixed", "solving integer-fixed problems", "DualStrategy");
+    env->timing->createTimer("DualProblemsDiscrete", "solving MIP problems", "DualStrategy");
+    env->timing->createTimer("DualCutGenerationRootSearch", "root search for constraint cuts", "DualStrategy");
+    env->timing->createTimer("DualObjectiveRootSearch", "root search for objective cut", "DualStrategy");
 
-    env->timing->createTimer("PrimalStrategy", " - primal strategy");
-    env->timing->createTimer("PrimalBoundStrategyNLP", "   - solving NLP problems");
-    env->timing->createTimer("PrimalBoundStrategyRootSearch", "   - performing root searches");
+    env->timing->createTimer("PrimalStrategy", "primal strategy", "Total");
+    env->timing->createTimer("PrimalBoundStrategyNLP", "solving NLP problems", "PrimalStrategy");
+    env->timing->createTimer("PrimalBoundStrategyRootSearch", "performing root searches", "PrimalStrategy");
 
     auto tFinalizeSolution = std::make_shared<TaskSequential>(env);
 
@@ -135,6 +136,14 @@ SolutionStrategyMultiTree::SolutionStrategyMultiTree(EnvironmentPtr envPtr)
     auto tSolveIteration = std::make_shared<TaskSolveIteration>(env);
     env->tasks->addTask(tSolveIteration, "SolveIter");
 
+    // The cuts cannot be removed if the dual problem is recreated in each iteration
+    if(env->settings->getSetting<int>("HyperplaneCuts.CutPool.MaxInactiveIterations", "Dual") > 0
+        && !env->settings->getSetting<bool>("TreeStrategy.Multi.Reinitialize", "Dual"))
+    {
+        auto tUpdateCutPool = std::make_shared<TaskUpdateCutPool>(env);
+        env->tasks->addTask(tUpdateCutPool, "UpdateCutPool");
+    }
+
     auto tSelectPrimSolPool = std::make_shared<TaskSelectPrimalCandidatesFromSolutionPool>(env);
     env->tasks->addTask(tSelectPrimSolPool, "SelectPrimSolPool");
     std::dynamic_pointer_cast<TaskSequential>(tFinalizeSolution)->addTask(tSelectPrimSolPool);
@@ -77,16 +77,16 @@ SolutionStrategyNLP::SolutionStrategyNLP(EnvironmentPtr envPtr)
 {
     env = envPtr;
 
-    env->timing->createTimer("InteriorPointSearch", " - interior point search");
+    env->timing->createTimer("InteriorPointSearch", "interior point search", "Total");
 
-    env->timing->createTimer("DualStrategy", " - dual strategy");
-    env->timing->createTimer("DualProblemsRelaxed", "   - solving relaxed problems");
-    env->timing->createTimer("DualProblemsDiscrete", "   - solving MIP problems");
-    env->timing->createTimer("DualCutGenerationRootSearch", "   - root search for constraint cuts");
-    env->timing->createTimer("DualObjectiveRootSearch", "   - root search for objective cut");
+    env->timing->createTimer("DualStrategy", "dual strategy", "Total");
+    env->timing->createTimer("DualProblemsRelaxed", "solving relaxed problems", "DualStrategy");
+    env->timing->createTimer("DualProblemsDiscrete", "solving MIP problems", "DualStrategy");
+    env->timing->createTimer("DualCutGenerationRootSearch", "root search for constraint cuts", "DualStrategy");
+    env->timing->createTimer("DualObjectiveRootSearch", "root search for objective cut", "DualStrategy");
 
-    env->timing->createTimer("PrimalStrategy", " - primal strategy");
-    env->timing->createTimer("PrimalBoundStrategyRootSearch", "   - performing root searches");
+    env->timing->createTimer("PrimalStrategy", "primal strategy", "Total");
+    env->timing->createTimer("PrimalBoundStrategyRootSearch", "performing root searches", "PrimalStrategy");
 
     auto tFinalizeSolution = std::make_shared<TaskSequential>(env);
 
@@ -59,10 +59,10 @@ Solver::Solver()
     env->timing->createTimer("Total", "Total solution time");
     env->timing->startTimer("Total");
 
-    env->timing->createTimer("ProblemInitialization", " - problem initialization");
-    env->timing->createTimer("ProblemReformulation", " - problem reformulation");
-    env->timing->createTimer("BoundTightening", " - bound tightening");
-    env->timing->createTimer("BoundTighteningFBBT", "   - feasibility based");
+    env->timing->createTimer("ProblemInitialization", "problem initialization", "Total");
+    env->timing->createTimer("ProblemReformulation", "problem reformulation", "Total");
+    env->timing->createTimer("BoundTightening", "bound tightening", "Total");
+    env->timing->createTimer("BoundTighteningFBBT", "feasibility based", "BoundTightening");
 
     env->settings = std::make_shared<Settings>(env->output);
     env->tasks = std::make_shared<TaskHandler>(env);
@@ -88,10 +88,10 @@ Solver::Solver(std::shared_ptr<spdlog::sinks::sink> consoleSink)
     env->timing->createTimer("Total", "Total solution time");
     env->timing->startTimer("Total");
 
-    env->timing->createTimer("ProblemInitialization", " - problem initialization");
-    env->timing->createTimer("ProblemReformulation", " - problem reformulation");
-    env->timing->createTimer("BoundTightening", " - bound tightening");
-    env->timing->createTimer("BoundTighteningFBBT", "   - feasibility based");
+    env->timing->createTimer("ProblemInitialization", "problem initialization", "Total");
+    env->timing->createTimer("ProblemReformulation", "problem reformulation", "Total");
+    env->timing->createTimer("BoundTightening", "bound tightening", "Total");
+    env->timing->createTimer("BoundTighteningFBBT", "feasibility based", "BoundTightening");
 
     env->settings = std::make_shared<Settings>(env->output);
     env->tasks = std::make_shared<TaskHandler>(env);
@@ -659,6 +659,16 @@ void Solver::initializeSettings()
     env->settings->createSetting("ESH.Rootsearch.ConstraintTolerance", "Dual", 1e-8,
         "Constraint tolerance for when not to add individual hyperplanes", 0, SHOT_DBL_MAX);
 
+    env->settings->createSetting("ESH.Rootsearch.NumberOfThreads", "Dual", 0,
+        "Number of threads to use for the root searches: 0: Automatic", 0, 999);
+
+    env->settings->createSetting("ESH.Rootsearch.MultipleConstraints", "Dual", true,
+        "Search for the boundaries of all constraints selected for the same points in one pass");
+
+    env->settings->createSetting("ESH.Rootsearch.WarmStartWidth", "Dual", 0.1,
+        "Width of the initial root search bracket around the boundary in the previous iteration: 0: Disabled", 0.0,
+        1.0);
+
     // Dual strategy settings: Fixed integer (NLP) strategy
 
     env->settings->createSetting("FixedInteger.ConstraintTolerance", "Dual", 0.0001,
@@ -678,12 +688,44 @@ void Solver::initializeSettings()
     env->settings->createSetting("HyperplaneCuts.ConstraintSelectionFactor", "Dual", 0.5,
         "The fraction of violated constraints to generate supporting hyperplanes / cutting planes for", 0.0, 1.0);
 
+    env->settings->createSetting("HyperplaneCuts.CutPool.InactiveTolerance", "Dual", 1e-6,
+        "A hyperplane is inactive in a dual solution if its slack is larger than this", 0.0, SHOT_DBL_MAX);
+
+    env->settings->createSetting("HyperplaneCuts.CutPool.MaxInactiveIterations", "Dual", 0,
+        "Remove hyperplanes inactive in this many consecutive dual solutions from the dual problem to a cut pool, from "
+        "where they are added back when violated: 0: Never remove (only supported with Cbc)",
+        0, SHOT_INT_MAX);
+
+    env->settings->createSetting("HyperplaneCuts.CutPool.RemovalFrequency", "Dual", 10,
+        "Number of iterations between the removals of inactive hyperplanes", 1, SHOT_INT_MAX);
+
     env->settings->createSetting(
         "HyperplaneCuts.Delay", "Dual", true, "Add hyperplane cuts to model only after optimal MIP solution");
 
+    env->settings->createSetting("HyperplaneCuts.DuplicatePointTolerance", "Dual", 1e-10,
+        "Hyperplanes for a constraint in points closer than this are not added again: 0: Exact comparison", 0.0,
+        SHOT_DBL_MAX);
+
+    env->settings->createSetting("HyperplaneCuts.MaxParallelism", "Dual", 0.999,
+        "Do not add hyperplanes with a larger cosine of the angle to a hyperplane selected in the same iteration", 0.0,
+        1.0);
+
     env->settings->createSetting("HyperplaneCuts.MaxPerIteration", "Dual", 200,
         "Maximal number of hyperplanes to add per iteration", 0, SHOT_INT_MAX);
 
+    env->settings->createSetting("HyperplaneCuts.NearDuplicateTolerance", "Dual", 0.0,
+        "Do not add hyperplanes with normalized coefficients equal to an added one within this tolerance: 0: Disabled",
+        0.0, 1.0);
+
+    env->settings->createSetting("HyperplaneCuts.ParallelismPenalty", "Dual", 0.5,
+        "Reduce the efficacy of a hyperplane by this fraction times its largest cosine of the angle to a hyperplane "
+        "selected in the same iteration",
+        0.0, 1.0);
+
+    env->settings->createSetting("HyperplaneCuts.SelectByEfficacy", "Dual", true,
+        "Select the hyperplanes added per iteration by their efficacy (violation divided by gradient norm) in the "
+        "dual solution");
+
     env->settings->createSetting("HyperplaneCuts.UseIntegerCuts", "Dual", false,
         "Add integer cuts for infeasible integer-combinations for binary problems");
 
@@ -811,6 +853,23 @@ void Solver::initializeSettings()
     env->settings->createSetting("NonlinearObjectiveVariable.Bound", "Model", 1e12,
         "Max absolute bound for the auxiliary nonlinear objective variable", SHOT_DBL_MIN, SHOT_DBL_MAX);
 
+    env->settings->createSetting("NonlinearExpressions.OptimizeTape", "Model", true,
+        "Remove redundant operations from the automatic differentiation tape of the nonlinear expressions");
+
+    env->settings->createSetting("NonlinearExpressions.EliminateCommonSubexpressions", "Model", true,
+        "Share identical subexpressions between the nonlinear expressions so that they are only calculated once");
+
+    env->settings->createSetting("NonlinearExpressions.CompiledCode.Use", "Model", false,
+        "Evaluate the nonlinear functions with C code compiled by the system compiler");
+
+    std::string codeCompiler = "cc";
+    env->settings->createSetting("NonlinearExpressions.CompiledCode.Compiler", "Model", codeCompiler,
+        "Compiler command used for the generated code of the nonlinear functions");
+
+    std::string codeCachePath = "";
+    env->settings->createSetting("NonlinearExpressions.CompiledCode.CachePath", "Model", codeCachePath,
+        "Directory for the compiled nonlinear functions (uses the temporary directory if empty)");
+
     // Reformulations for bilinears
     env->settings->createSetting("Reformulation.Bilinear.AddConvexEnvelope", "Model", false,
         "Add convex envelopes (subject to original bounds) to bilinear terms");
@@ -1015,6 +1074,16 @@ void Solver::initializeSettings()
     env->settings->createSetting("Tolerance.NonlinearConstraint", "Primal", 1e-6,
         "Nonlinear constraint tolerance for accepting primal solutions");
 
+    // Subsolver settings: Cbc
+
+    env->settings->createSetting("Cbc.PersistentModel", "Subsolver", false,
+        "Solve the LP relaxation of the dual problem from the optimal basis of the previous iteration before each Cbc "
+        "solve, so that Cbc starts from an optimal root basis");
+
+    env->settings->createSetting("Cbc.UseSingleTree", "Subsolver", false,
+        "Allow the single-tree strategy with Cbc, where the hyperplanes are added in the branch-and-bound tree by a cut "
+        "generator; otherwise the multi-tree strategy is always used with Cbc");
+
     // Subsolver settings: Cplex
 
     env->settings->createSetting("Cplex.AddRelaxedLazyConstraintsAsLocal", "Subsolver", false,
@@ -1118,6 +1187,7 @@ void Solver::initializeSettings()
     enumRootsearchMethod.push_back("BoostTOMS748");
     enumRootsearchMethod.push_back("BoostBisection");
     enumRootsearchMethod.push_back("Bisection");
+    enumRootsearchMethod.push_back("Safeguarded Newton");
     env->settings->createSetting("Rootsearch.Method", "Subsolver", static_cast<int>(ES_RootsearchMethod::BoostTOMS748),
         "Root search method to use", enumRootsearchMethod);
     enumRootsearchMethod.clear();
@@ -1287,7 +1357,9 @@ void Solver::verifySettings()
         unboundedVariableBound = 1e50;
 
         // Some features are not available in Cbc
-        env->settings->updateSetting("TreeStrategy", "Dual", static_cast<int>(ES_TreeStrategy::MultiTree));
+        if(!env->settings->getSetting<bool>("Cbc.UseSingleTree", "Subsolver"))
+            env->settings->updateSetting("TreeStrategy", "Dual", static_cast<int>(ES_TreeStrategy::MultiTree));
+
         env->settings->updateSetting(
             "Reformulation.Quadratics.Strategy", "Model", static_cast<int>(ES_QuadraticProblemStrategy::Nonlinear));
     }
@@ -11,7 +11,9 @@
 #pragma once
 
 #include "Enums.h"
+#include "Model/SparseVector.h"
 
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -76,6 +78,7 @@ class PrimalSolver;
 
 class Constraint;
 class NumericConstraint;
+class Variable;
 
 using ResultsPtr = std::shared_ptr<Results>;
 using SettingsPtr = std::shared_ptr<Settings>;
@@ -96,6 +99,9 @@ using IterationPtr = std::shared_ptr<Iteration>;
 using ConstraintPtr = std::shared_ptr<Constraint>;
 using NumericConstraintPtr = std::shared_ptr<NumericConstraint>;
 
+using VariablePtr = std::shared_ptr<Variable>;
+using SparseVariableVector = SparseVector<VariablePtr>;
+
 using PairInteger = std::pair<int, int>;
 using PairDouble = std::pair<double, double>;
 using PairString = std::pair<std::string, std::string>;
@@ -120,6 +126,8 @@ struct PairCoordinateValue
     double value;
 };
 
+struct NumericConstraintValue;
+
 struct SolutionPoint
 {
     VectorDouble point;
@@ -127,6 +135,10 @@ struct SolutionPoint
     int iterFound;
     PairIndexValue maxDeviation;
     bool isRelaxedPoint = false;
+
+    // The values of the nonlinear constraints in the point sorted with the largest deviation first, if calculated when
+    // the point was obtained. Shared between copies of the point.
+    std::shared_ptr<const std::vector<NumericConstraintValue>> nonlinearConstraintValues;
 };
 
 struct InteriorPoint
@@ -178,6 +190,29 @@ struct Hyperplane
     double objectiveFunctionValue; // Used for the objective cuts only
     E_HyperplaneSource source;
     bool isObjectiveHyperplane = false;
+    SparseVariableVector gradient; // Calculated in advance if not empty
+};
+
+// Linear constraints sum_j coefficients[j] * x[columnIndices[j]] + constants[i] <= 0 in compressed sparse row form, the
+// elements of row i are in the positions rowStarts[i], ..., rowStarts[i + 1] - 1
+struct LinearConstraintRows
+{
+    VectorInteger rowStarts = { 0 };
+    VectorInteger columnIndices;
+    VectorDouble coefficients;
+    VectorDouble constants;
+    VectorString names;
+
+    inline size_t size() const { return (constants.size()); }
+
+    inline void removeLastRow()
+    {
+        rowStarts.pop_back();
+        columnIndices.resize(rowStarts.back());
+        coefficients.resize(rowStarts.back());
+        constants.pop_back();
+        names.pop_back();
+    }
 };
 
 struct GeneratedHyperplane
@@ -208,6 +243,21 @@ struct SolutionStatistics
     int numberOfFunctionEvalutions = 0;
     int numberOfGradientEvaluations = 0;
 
+    // The root searches can be performed in parallel, so these are updated atomically
+    std::atomic<int> numberOfRootsearches{ 0 };
+    std::atomic<int> numberOfRootsearchFunctionEvaluations{ 0 };
+    // Started from a narrowed bracket around the boundary found in the previous iteration
+    std::atomic<int> numberOfWarmStartedRootsearches{ 0 };
+    // Compared to the number of evaluations a bisection would need to reach the termination tolerance
+    std::atomic<int> numberOfRootsearchFunctionEvaluationsSaved{ 0 };
+
+    // Rejected by the deduplication index of the dual solver
+    int numberOfDuplicateHyperplanesRejected = 0;
+    int numberOfNearDuplicateHyperplanesRejected = 0;
+
+    int numberOfHyperplanesRemovedToCutPool = 0;
+    int numberOfHyperplanesAddedFromCutPool = 0;
+
     int numberOfProblemsMinimaxLP = 0;
 
     int numberOfProblemsNLPInteriorPointSearch = 0;
@@ -14,63 +14,117 @@
 #include "../Model/Problem.h"
 
 #include "../DualSolver.h"
+#include "../Iteration.h"
 #include "../MIPSolver/IMIPSolver.h"
 #include "../Output.h"
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Timing.h"
+#include "../Utilities.h"
+
+#include <cmath>
+#include <map>
+#include <unordered_map>
 
 namespace SHOT
 {
 
 TaskAddHyperplanes::TaskAddHyperplanes(EnvironmentPtr envPtr) : TaskBase(envPtr)
 {
-    env->timing->startTimer("DualStrategy");
+    dualStrategyTimer = env->timing->getTimerIndex("DualStrategy");
+
+    env->timing->startTimer(dualStrategyTimer);
     itersWithoutAddedHPs = 0;
 
-    env->timing->stopTimer("DualStrategy");
+    delayHyperplanes = env->settings->getSettingRef<bool>("HyperplaneCuts.Delay", "Dual");
+    maxHyperplanesPerIteration = env->settings->getSettingRef<int>("HyperplaneCuts.MaxPerIteration", "Dual");
+    efficacySelection = env->settings->getSettingRef<bool>("HyperplaneCuts.SelectByEfficacy", "Dual");
+    reinitializeTree = env->settings->getSettingRef<bool>("TreeStrategy.Multi.Reinitialize", "Dual");
+    maxParallelism = env->settings->getSettingRef<double>("HyperplaneCuts.MaxParallelism", "Dual");
+    parallelismPenalty = env->settings->getSettingRef<double>("HyperplaneCuts.ParallelismPenalty", "Dual");
+
+    env->timing->stopTimer(dualStrategyTimer);
 }
 
 TaskAddHyperplanes::~TaskAddHyperplanes() = default;
 
 void TaskAddHyperplanes::run()
 {
-    env->timing->startTimer("DualStrategy");
+    ScopedTimer timer(*env->timing, dualStrategyTimer);
 
     auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
 
-    if(!currIter->isMIP() || !env->settings->getSetting<bool>("HyperplaneCuts.Delay", "Dual")
-        || !currIter->MIPSolutionLimitUpdated || itersWithoutAddedHPs > 5)
+    if(!currIter->isMIP() || !delayHyperplanes.get() || !currIter->MIPSolutionLimitUpdated || itersWithoutAddedHPs > 5)
     {
         int addedHyperplanes = 0;
+        int maxHyperplanes = maxHyperplanesPerIteration.get();
+        auto& waitingList = env->dualSolver->hyperplaneWaitingList;
 
-        for(auto k = env->dualSolver->hyperplaneWaitingList.size(); k > 0; k--)
+        // When reinitializing, the waiting list contains all hyperplanes and should be added as a whole
+        bool selectByEfficacy = efficacySelection.get() && !reinitializeTree.get()
+            && env->results->getNumberOfIterations() > 1
+            && env->results->getPreviousIteration()->solutionPoints.size() > 0;
+
+        std::vector<size_t> hyperplaneOrder;
+
+        if(selectByEfficacy)
         {
-            if(addedHyperplanes >= env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual"))
-                break;
+            calculateHyperplaneGradients(static_cast<int>(waitingList.size()), true);
 
-            auto tmpItem = env->dualSolver->hyperplaneWaitingList.at(k - 1);
+            hyperplaneOrder = selectHyperplanesByEfficacy(
+                env->results->getPreviousIteration()->solutionPoints.at(0).point, maxHyperplanes);
+        }
+        else
+        {
+            calculateHyperplaneGradients(maxHyperplanes, false);
 
-            bool cutAddedSuccessfully = false;
+            for(auto k = waitingList.size(); k > 0; k--)
+                hyperplaneOrder.push_back(k - 1);
+        }
 
-            if(tmpItem.source == E_HyperplaneSource::PrimalSolutionSearchInteriorObjective)
-            {
-                cutAddedSuccessfully = env->dualSolver->MIPSolver->createInteriorHyperplane(tmpItem);
-            }
-            else
+        // The hyperplanes are added to the dual problem together, and those that could not be added are replaced by
+        // the following ones in the order
+        auto nextHyperplane = hyperplaneOrder.begin();
+
+        while(addedHyperplanes < maxHyperplanes && nextHyperplane != hyperplaneOrder.end())
+        {
+            std::vector<Hyperplane> hyperplanes;
+
+            for(; nextHyperplane != hyperplaneOrder.end()
+                && addedHyperplanes + static_cast<int>(hyperplanes.size()) < maxHyperplanes;
+                nextHyperplane++)
             {
-                cutAddedSuccessfully = env->dualSolver->MIPSolver->createHyperplane(tmpItem);
+                auto& tmpItem = waitingList.at(*nextHyperplane);
+
+                if(tmpItem.source == E_HyperplaneSource::PrimalSolutionSearchInteriorObjective)
+                {
+                    if(env->dualSolver->MIPSolver->createInteriorHyperplane(tmpItem))
+                    {
+                        env->dualSolver->addGeneratedHyperplane(tmpItem);
+                        addedHyperplanes++;
+                        this->itersWithoutAddedHPs = 0;
+                    }
+
+                    continue;
+                }
+
+                hyperplanes.push_back(tmpItem);
             }
 
-            if(cutAddedSuccessfully)
+            auto isAdded = env->dualSolver->MIPSolver->createHyperplanes(hyperplanes);
+
+            for(size_t i = 0; i < hyperplanes.size(); i++)
             {
-                env->dualSolver->addGeneratedHyperplane(tmpItem);
+                if(!isAdded[i])
+                    continue;
+
+                env->dualSolver->addGeneratedHyperplane(hyperplanes[i]);
                 addedHyperplanes++;
                 this->itersWithoutAddedHPs = 0;
             }
         }
 
-        if(!env->settings->getSetting<bool>("TreeStrategy.Multi.Reinitialize", "Dual"))
+        if(!reinitializeTree.get())
         {
             env->dualSolver->hyperplaneWaitingList.clear();
         }
@@ -79,8 +133,193 @@ void TaskAddHyperplanes::run()
     {
         this->itersWithoutAddedHPs++;
     }
+}
+
+void TaskAddHyperplanes::calculateHyperplaneGradients(int maxNumberOfHyperplanes, bool calculateAll)
+{
+    auto& waitingList = env->dualSolver->hyperplaneWaitingList;
+
+    // The hyperplanes are added starting from the end of the waiting list
+    std::unordered_map<std::size_t, std::vector<size_t>> hyperplanesInPoint;
+    int numberOfHyperplanes = 0;
+
+    for(auto k = waitingList.size(); k > 0 && numberOfHyperplanes < maxNumberOfHyperplanes; k--)
+    {
+        auto& hyperplane = waitingList.at(k - 1);
+
+        if(hyperplane.isObjectiveHyperplane || !hyperplane.sourceConstraint
+            || hyperplane.source == E_HyperplaneSource::PrimalSolutionSearchInteriorObjective)
+            continue;
+
+        hyperplanesInPoint[Utilities::calculateHash(hyperplane.generatedPoint)].push_back(k - 1);
+        numberOfHyperplanes++;
+    }
+
+    for(auto& [hash, indexes] : hyperplanesInPoint)
+    {
+        if(indexes.size() < 2 && !calculateAll)
+            continue;
+
+        auto& point = waitingList.at(indexes[0]).generatedPoint;
+
+        NumericConstraints constraints;
+        std::vector<size_t> hyperplaneIndexes;
+
+        for(auto I : indexes)
+        {
+            if(waitingList.at(I).generatedPoint != point)
+                continue;
+
+            constraints.push_back(waitingList.at(I).sourceConstraint);
+            hyperplaneIndexes.push_back(I);
+        }
+
+        auto gradients = env->reformulatedProblem->calculateConstraintGradients(point, constraints, true);
+
+        for(size_t i = 0; i < hyperplaneIndexes.size(); i++)
+            waitingList.at(hyperplaneIndexes[i]).gradient = std::move(gradients[i]);
+    }
+}
+
+std::vector<size_t> TaskAddHyperplanes::selectHyperplanesByEfficacy(
+    const VectorDouble& dualSolution, int maxNumberOfHyperplanes)
+{
+    auto& waitingList = env->dualSolver->hyperplaneWaitingList;
+
+    struct Candidate
+    {
+        size_t index;
+        std::map<int, double> elements;
+        double norm;
+        double efficacy;
+        double parallelism = 0.0;
+        bool isSelectable = true;
+    };
+
+    std::vector<size_t> selectedHyperplanes;
+    std::vector<Candidate> candidates;
+
+    for(auto k = waitingList.size(); k > 0; k--)
+    {
+        auto& hyperplane = waitingList.at(k - 1);
+
+        // The objective hyperplanes are not compared with the others and are always added first
+        if(hyperplane.isObjectiveHyperplane || !hyperplane.sourceConstraint
+            || hyperplane.source == E_HyperplaneSource::PrimalSolutionSearchInteriorObjective)
+        {
+            selectedHyperplanes.push_back(k - 1);
+            continue;
+        }
+
+        auto terms = env->dualSolver->MIPSolver->createHyperplaneTerms(hyperplane);
+
+        if(!terms)
+            continue;
+
+        double squaredNorm = 0.0;
+        double violation = terms->second;
+        bool isInSolution = true;
+
+        for(auto& [variableIndex, coefficient] : terms->first)
+        {
+            if(variableIndex >= static_cast<int>(dualSolution.size()))
+            {
+                isInSolution = false;
+                break;
+            }
+
+            squaredNorm += coefficient * coefficient;
+            violation += coefficient * dualSolution[variableIndex];
+        }
+
+        if(!isInSolution || squaredNorm == 0.0 || std::isnan(violation))
+        {
+            selectedHyperplanes.push_back(k - 1);
+            continue;
+        }
+
+        double norm = std::sqrt(squaredNorm);
+        candidates.push_back({ k - 1, std::move(terms->first), norm, violation / norm });
+    }
+
+    int numberOfParallelHyperplanes = 0;
+
+    while(selectedHyperplanes.size() < static_cast<size_t>(maxNumberOfHyperplanes))
+    {
+        Candidate* bestCandidate = nullptr;
+        double bestScore = 0.0;
+
+        for(auto& C : candidates)
+        {
+            if(!C.isSelectable)
+                continue;
+
+            double score = C.efficacy - parallelismPenalty.get() * C.parallelism * std::abs(C.efficacy);
+
+            if(bestCandidate == nullptr || score > bestScore)
+            {
+                bestCandidate = &C;
+                bestScore = score;
+            }
+        }
+
+        if(bestCandidate == nullptr)
+            break;
+
+        bestCandidate->isSelectable = false;
+        selectedHyperplanes.push_back(bestCandidate->index);
+
+        // Only hyperplanes pointing in the same direction are considered parallel, since opposite ones are needed to
+        // bound the variables from both sides
+        for(auto& C : candidates)
+        {
+            if(!C.isSelectable)
+                continue;
+
+            double product = 0.0;
+            auto first = bestCandidate->elements.begin();
+            auto second = C.elements.begin();
+
+            while(first != bestCandidate->elements.end() && second != C.elements.end())
+            {
+                if(first->first < second->first)
+                {
+                    first++;
+                }
+                else if(second->first < first->first)
+                {
+                    second++;
+                }
+                else
+                {
+                    product += first->second * second->second;
+                    first++;
+                    second++;
+                }
+            }
+
+            double parallelism = product / (bestCandidate->norm * C.norm);
+
+            if(parallelism > maxParallelism.get())
+            {
+                C.isSelectable = false;
+                numberOfParallelHyperplanes++;
+            }
+            else
+            {
+                C.parallelism = std::max(C.parallelism, parallelism);
+            }
+        }
+    }
+
+    if(numberOfParallelHyperplanes > 0)
+    {
+        env->output->outputDebug(fmt::format("        Selected {} hyperplanes by efficacy, {} not added since they are "
+                                             "almost parallel to a selected one.",
+            selectedHyperplanes.size(), numberOfParallelHyperplanes));
+    }
 
-    env->timing->stopTimer("DualStrategy");
+    return (selectedHyperplanes);
 }
 
 std::string TaskAddHyperplanes::getType()
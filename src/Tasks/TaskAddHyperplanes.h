@@ -11,6 +11,8 @@
 #pragma once
 #include "TaskBase.h"
 
+#include "../Settings.h"
+
 namespace SHOT
 {
 class TaskAddHyperplanes : public TaskBase
@@ -25,5 +27,21 @@ public:
 
 private:
     int itersWithoutAddedHPs;
+
+    SettingRef<bool> delayHyperplanes;
+    SettingRef<int> maxHyperplanesPerIteration;
+    SettingRef<bool> efficacySelection;
+    SettingRef<bool> reinitializeTree;
+    SettingRef<double> maxParallelism;
+    SettingRef<double> parallelismPenalty;
+
+    int dualStrategyTimer;
+
+    // Calculates the gradients of the hyperplanes generated in the same point together, and if calculateAll is true
+    // also those of the hyperplanes generated alone in a point
+    void calculateHyperplaneGradients(int maxNumberOfHyperplanes, bool calculateAll);
+
+    // Returns the indexes in the waiting list of the hyperplanes to add, in the order they should be added
+    std::vector<size_t> selectHyperplanesByEfficacy(const VectorDouble& dualSolution, int maxNumberOfHyperplanes);
 };
 } // namespace SHOT
\ No newline at end of file
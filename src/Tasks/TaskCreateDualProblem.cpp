@@ -54,6 +54,7 @@ void TaskCreateDualProblem::run()
         env->output->outputDebug("Recreating dual problem");
 
         createProblem(env->dualSolver->MIPSolver, env->reformulatedProblem);
+        env->dualSolver->clearHyperplaneCoefficients();
 
         env->dualSolver->MIPSolver->finalizeProblem();
 
@@ -30,6 +30,7 @@
 
 #ifdef HAS_CBC
 #include "../MIPSolver/MIPSolverCbc.h"
+#include "../MIPSolver/MIPSolverCbcSingleTree.h"
 #endif
 
 namespace SHOT
@@ -78,9 +79,9 @@ TaskInitializeDualSolver::TaskInitializeDualSolver(EnvironmentPtr envPtr, bool u
 #ifdef HAS_CBC
         if(solver == ES_MIPSolver::Cbc)
         {
-            env->dualSolver->MIPSolver = MIPSolverPtr(std::make_shared<MIPSolverCbc>(env));
+            env->dualSolver->MIPSolver = MIPSolverPtr(std::make_shared<MIPSolverCbcSingleTree>(env));
             env->results->usedMIPSolver = ES_MIPSolver::Cbc;
-            env->output->outputDebug("Cbc selected as MIP solver.");
+            env->output->outputDebug("Cbc with lazy hyperplane cut generator selected as MIP solver.");
             solverSelected = true;
         }
 #endif
@@ -43,6 +43,17 @@ TaskReformulateProblem::TaskReformulateProblem(EnvironmentPtr envPtr) : TaskBase
     partitionQuadraticTermsInConstraint
         = env->settings->getSetting<bool>("Reformulation.Constraint.PartitionQuadraticTerms", "Model");
 
+    // These are read for each term
+    objectivePartitioning
+        = env->settings->getSettingRef<int>("Reformulation.ObjectiveFunction.PartitionNonlinearTerms", "Model");
+    constraintPartitioning
+        = env->settings->getSettingRef<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model");
+    monomialFormulation = env->settings->getSettingRef<int>("Reformulation.Monomials.Formulation", "Model");
+    bilinearIntegerFormulation
+        = env->settings->getSettingRef<int>("Reformulation.Bilinear.IntegerFormulation", "Model");
+    minimumLowerBound = env->settings->getSettingRef<double>("ContinuousVariable.MinimumLowerBound", "Model");
+    maximumUpperBound = env->settings->getSettingRef<double>("ContinuousVariable.MaximumUpperBound", "Model");
+
     auxVariableCounter = env->problem->properties.numberOfVariables;
     auxConstraintCounter = env->problem->properties.numberOfNumericConstraints;
 
@@ -291,7 +302,7 @@ void TaskReformulateProblem::reformulateObjectiveFunction()
             {
                 if(isSignReversed)
                 {
-                    constraint->add(simplify(std::make_shared<ExpressionNegate>(copyNonlinearExpression(
+                    constraint->add(simplify(makeExpression<ExpressionNegate>(copyNonlinearExpression(
                         std::dynamic_pointer_cast<NonlinearObjectiveFunction>(env->problem->objectiveFunction)
                             ->nonlinearExpression.get(),
                         reformulatedProblem))));
@@ -382,9 +393,7 @@ void TaskReformulateProblem::reformulateObjectiveFunction()
     {
         auto sourceObjective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(env->problem->objectiveFunction);
 
-        if(static_cast<ES_PartitionNonlinearSums>(
-               env->settings->getSetting<int>("Reformulation.ObjectiveFunction.PartitionNonlinearTerms", "Model"))
-                == ES_PartitionNonlinearSums::Always
+        if(static_cast<ES_PartitionNonlinearSums>(objectivePartitioning.get()) == ES_PartitionNonlinearSums::Always
             && sourceObjective->monomialTerms.size() > 1)
         {
             auto tmpLinearTerms = partitionMonomialTerms(sourceObjective->monomialTerms, isSignReversed);
@@ -401,16 +410,13 @@ void TaskReformulateProblem::reformulateObjectiveFunction()
     {
         auto sourceObjective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(env->problem->objectiveFunction);
 
-        if(static_cast<ES_PartitionNonlinearSums>(
-               env->settings->getSetting<int>("Reformulation.ObjectiveFunction.PartitionNonlinearTerms", "Model"))
-                == ES_PartitionNonlinearSums::Always
+        if(static_cast<ES_PartitionNonlinearSums>(objectivePartitioning.get()) == ES_PartitionNonlinearSums::Always
             && sourceObjective->signomialTerms.size() > 1)
         {
             auto tmpLinearTerms = partitionSignomialTerms(sourceObjective->signomialTerms, isSignReversed);
             destinationLinearTerms.add(tmpLinearTerms);
         }
-        else if(static_cast<ES_PartitionNonlinearSums>(
-                    env->settings->getSetting<int>("Reformulation.ObjectiveFunction.PartitionNonlinearTerms", "Model"))
+        else if(static_cast<ES_PartitionNonlinearSums>(objectivePartitioning.get())
                 == ES_PartitionNonlinearSums::IfConvex
             && sourceObjective->signomialTerms.size() > 1)
         {
@@ -443,17 +449,14 @@ void TaskReformulateProblem::reformulateObjectiveFunction()
     {
         auto sourceObjective = std::dynamic_pointer_cast<NonlinearObjectiveFunction>(env->problem->objectiveFunction);
 
-        if(static_cast<ES_PartitionNonlinearSums>(
-               env->settings->getSetting<int>("Reformulation.ObjectiveFunction.PartitionNonlinearTerms", "Model"))
-                == ES_PartitionNonlinearSums::Always
+        if(static_cast<ES_PartitionNonlinearSums>(objectivePartitioning.get()) == ES_PartitionNonlinearSums::Always
             && sourceObjective->nonlinearExpression->getType() == E_NonlinearExpressionTypes::Sum)
         {
             auto tmpLinearTerms = partitionNonlinearSum(
                 std::dynamic_pointer_cast<ExpressionSum>(sourceObjective->nonlinearExpression), isSignReversed);
             destinationLinearTerms.add(tmpLinearTerms);
         }
-        else if(static_cast<ES_PartitionNonlinearSums>(
-                    env->settings->getSetting<int>("Reformulation.ObjectiveFunction.PartitionNonlinearTerms", "Model"))
+        else if(static_cast<ES_PartitionNonlinearSums>(objectivePartitioning.get())
                 == ES_PartitionNonlinearSums::IfConvex
             && sourceObjective->nonlinearExpression->getType() == E_NonlinearExpressionTypes::Sum)
         {
@@ -524,7 +527,7 @@ void TaskReformulateProblem::reformulateObjectiveFunction()
         {
             if(isSignReversed)
                 std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objective)->add(
-                    simplify(std::make_shared<ExpressionNegate>(
+                    simplify(makeExpression<ExpressionNegate>(
                         copyNonlinearExpression(sourceObjective->nonlinearExpression.get(), reformulatedProblem))));
             else
                 std::dynamic_pointer_cast<NonlinearObjectiveFunction>(objective)->add(
@@ -652,12 +655,12 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
             for(auto& LT : std::dynamic_pointer_cast<LinearConstraint>(reformulatedConstraint1.at(0))->linearTerms)
             {
                 if(LT->coefficient == 1.0)
-                    nonlinearConstraint->add(std::make_shared<ExpressionVariable>(LT->variable));
+                    nonlinearConstraint->add(makeExpression<ExpressionVariable>(LT->variable));
                 else
                 {
                     nonlinearConstraint->add(
-                        std::make_shared<ExpressionProduct>(std::make_shared<ExpressionConstant>(LT->coefficient),
-                            std::make_shared<ExpressionVariable>(LT->variable)));
+                        makeExpression<ExpressionProduct>(makeExpression<ExpressionConstant>(LT->coefficient),
+                            makeExpression<ExpressionVariable>(LT->variable)));
                 }
             }
         }
@@ -671,13 +674,13 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
 
                 if(QT->coefficient != 1.0)
                 {
-                    product.push_back(std::make_shared<ExpressionConstant>(QT->coefficient));
+                    product.push_back(makeExpression<ExpressionConstant>(QT->coefficient));
                 }
 
-                product.push_back(std::make_shared<ExpressionVariable>(QT->firstVariable));
-                product.push_back(std::make_shared<ExpressionVariable>(QT->secondVariable));
+                product.push_back(makeExpression<ExpressionVariable>(QT->firstVariable));
+                product.push_back(makeExpression<ExpressionVariable>(QT->secondVariable));
 
-                nonlinearConstraint->add(std::make_shared<ExpressionProduct>(product));
+                nonlinearConstraint->add(makeExpression<ExpressionProduct>(product));
             }
         }
         // TODO add monomials and signomials
@@ -691,7 +694,7 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
         }
 
         nonlinearConstraint->nonlinearExpression
-            = std::make_shared<ExpressionSquare>(nonlinearConstraint->nonlinearExpression);
+            = makeExpression<ExpressionSquare>(nonlinearConstraint->nonlinearExpression);
 
         nonlinearConstraint->properties.convexity = E_Convexity::Nonconvex;
         return (NumericConstraints({ nonlinearConstraint }));
@@ -715,8 +718,7 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
     {
         auto sourceConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(C);
 
-        if(env->settings->getSetting<int>("Reformulation.Monomials.Formulation", "Model")
-            != static_cast<int>(ES_ReformulationBinaryMonomials::None))
+        if(monomialFormulation.get() != static_cast<int>(ES_ReformulationBinaryMonomials::None))
         // The product was a monomial term
         {
             auto [tmpLinearTerms, tmpMonomialTerms]
@@ -729,8 +731,7 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
             }
             else
             {
-                if(static_cast<ES_PartitionNonlinearSums>(
-                       env->settings->getSetting<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model"))
+                if(static_cast<ES_PartitionNonlinearSums>(constraintPartitioning.get())
                         == ES_PartitionNonlinearSums::Always
                     && tmpMonomialTerms.size() > 1)
                 {
@@ -746,9 +747,7 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
         }
         else
         {
-            if(static_cast<ES_PartitionNonlinearSums>(
-                   env->settings->getSetting<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model"))
-                    == ES_PartitionNonlinearSums::Always
+            if(static_cast<ES_PartitionNonlinearSums>(constraintPartitioning.get()) == ES_PartitionNonlinearSums::Always
                 && destinationMonomialTerms.size() > 1)
             {
                 auto tmpLinearTerms = partitionMonomialTerms(destinationMonomialTerms, isSignReversed);
@@ -766,16 +765,13 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
     {
         auto sourceConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(C);
 
-        if(static_cast<ES_PartitionNonlinearSums>(
-               env->settings->getSetting<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model"))
-                == ES_PartitionNonlinearSums::Always
+        if(static_cast<ES_PartitionNonlinearSums>(constraintPartitioning.get()) == ES_PartitionNonlinearSums::Always
             && sourceConstraint->signomialTerms.size() > 1)
         {
             auto tmpLinearTerms = partitionSignomialTerms(sourceConstraint->signomialTerms, isSignReversed);
             destinationLinearTerms.add(tmpLinearTerms);
         }
-        else if(static_cast<ES_PartitionNonlinearSums>(
-                    env->settings->getSetting<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model"))
+        else if(static_cast<ES_PartitionNonlinearSums>(constraintPartitioning.get())
                 == ES_PartitionNonlinearSums::IfConvex
             && sourceConstraint->signomialTerms.size() > 1)
         {
@@ -808,17 +804,14 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
     {
         auto sourceConstraint = std::dynamic_pointer_cast<NonlinearConstraint>(C);
 
-        if(static_cast<ES_PartitionNonlinearSums>(
-               env->settings->getSetting<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model"))
-                == ES_PartitionNonlinearSums::Always
+        if(static_cast<ES_PartitionNonlinearSums>(constraintPartitioning.get()) == ES_PartitionNonlinearSums::Always
             && sourceConstraint->nonlinearExpression->getType() == E_NonlinearExpressionTypes::Sum)
         {
             auto tmpLinearTerms = partitionNonlinearSum(
                 std::dynamic_pointer_cast<ExpressionSum>(sourceConstraint->nonlinearExpression), isSignReversed);
             destinationLinearTerms.add(tmpLinearTerms);
         }
-        else if(static_cast<ES_PartitionNonlinearSums>(
-                    env->settings->getSetting<int>("Reformulation.Constraint.PartitionNonlinearTerms", "Model"))
+        else if(static_cast<ES_PartitionNonlinearSums>(constraintPartitioning.get())
                 == ES_PartitionNonlinearSums::IfConvex
             && sourceConstraint->nonlinearExpression->getType() == E_NonlinearExpressionTypes::Sum)
         {
@@ -908,7 +901,7 @@ NumericConstraints TaskReformulateProblem::reformulateConstraint(NumericConstrai
 
         if(isSignReversed)
             std::dynamic_pointer_cast<NonlinearConstraint>(constraint)
-                ->add(simplify(std::make_shared<ExpressionNegate>(
+                ->add(simplify(makeExpression<ExpressionNegate>(
                     copyNonlinearExpression(sourceConstraint->nonlinearExpression.get(), reformulatedProblem))));
         else
             std::dynamic_pointer_cast<NonlinearConstraint>(constraint)
@@ -954,8 +947,7 @@ LinearTerms TaskReformulateProblem::partitionNonlinearSum(
             auto optionalMonomialTerm = convertProductToMonomialTerm(std::dynamic_pointer_cast<ExpressionProduct>(T));
 
             if(optionalMonomialTerm
-                && env->settings->getSetting<int>("Reformulation.Monomials.Formulation", "Model")
-                    != static_cast<int>(ES_ReformulationBinaryMonomials::None))
+                && monomialFormulation.get() != static_cast<int>(ES_ReformulationBinaryMonomials::None))
             // The product was a monomial term
             {
                 MonomialTerms monomialTerms;
@@ -978,8 +970,8 @@ LinearTerms TaskReformulateProblem::partitionNonlinearSum(
         {
             Interval bounds;
 
-            double varLowerBound = env->settings->getSetting<double>("ContinuousVariable.MinimumLowerBound", "Model");
-            double varUpperBound = env->settings->getSetting<double>("ContinuousVariable.MaximumUpperBound", "Model");
+            double varLowerBound = minimumLowerBound.get();
+            double varUpperBound = maximumUpperBound.get();
 
             try
             {
@@ -1005,7 +997,7 @@ LinearTerms TaskReformulateProblem::partitionNonlinearSum(
             if(reversedSigns)
             {
                 auxConstraint->add(simplify(
-                    std::make_shared<ExpressionNegate>(copyNonlinearExpression(T.get(), reformulatedProblem))));
+                    makeExpression<ExpressionNegate>(copyNonlinearExpression(T.get(), reformulatedProblem))));
             }
             else
             {
@@ -1033,8 +1025,8 @@ LinearTerms TaskReformulateProblem::partitionMonomialTerms(const MonomialTerms s
     {
         Interval bounds;
 
-        double varLowerBound = env->settings->getSetting<double>("ContinuousVariable.MinimumLowerBound", "Model");
-        double varUpperBound = env->settings->getSetting<double>("ContinuousVariable.MaximumUpperBound", "Model");
+        double varLowerBound = minimumLowerBound.get();
+        double varUpperBound = maximumUpperBound.get();
 
         try
         {
@@ -1084,8 +1076,8 @@ LinearTerms TaskReformulateProblem::partitionSignomialTerms(const SignomialTerms
     {
         Interval bounds;
 
-        double varLowerBound = env->settings->getSetting<double>("ContinuousVariable.MinimumLowerBound", "Model");
-        double varUpperBound = env->settings->getSetting<double>("ContinuousVariable.MaximumUpperBound", "Model");
+        double varLowerBound = minimumLowerBound.get();
+        double varUpperBound = maximumUpperBound.get();
 
         try
         {
@@ -1235,8 +1227,7 @@ std::tuple<LinearTerms, QuadraticTerms> TaskReformulateProblem::reformulateAndPa
             && T->secondVariable->upperBound <= 100)
         // bilinear term i1*i2
         {
-            if(env->settings->getSetting<int>("Reformulation.Bilinear.IntegerFormulation", "Model")
-                == static_cast<int>(ES_ReformulatiomBilinearInteger::TwoDiscretization))
+            if(bilinearIntegerFormulation.get() == static_cast<int>(ES_ReformulatiomBilinearInteger::TwoDiscretization))
             {
                 auto auxVariable = getBilinearAuxiliaryVariable(T->firstVariable, T->secondVariable);
 
@@ -1340,7 +1331,7 @@ std::tuple<LinearTerms, QuadraticTerms> TaskReformulateProblem::reformulateAndPa
                 reformulatedProblem->add(std::move(auxSecondSum));
                 reformulatedProblem->add(std::move(auxSecondSumVarDef));
             }
-            else if(env->settings->getSetting<int>("Reformulation.Bilinear.IntegerFormulation", "Model")
+            else if(bilinearIntegerFormulation.get()
                 == static_cast<int>(ES_ReformulatiomBilinearInteger::OneDiscretization))
             {
                 VariablePtr discretizationVariable;
@@ -1517,8 +1508,7 @@ std::tuple<LinearTerms, MonomialTerms> TaskReformulateProblem::reformulateMonomi
     for(auto& T : monomialTerms)
     {
         if(T->isBinary
-            && env->settings->getSetting<int>("Reformulation.Monomials.Formulation", "Model")
-                == static_cast<int>(ES_ReformulationBinaryMonomials::Simple))
+            && monomialFormulation.get() == static_cast<int>(ES_ReformulationBinaryMonomials::Simple))
         {
             auto N = T->variables.size();
 
@@ -1552,8 +1542,7 @@ std::tuple<LinearTerms, MonomialTerms> TaskReformulateProblem::reformulateMonomi
             reformulatedProblem->add(std::move(auxConstraint2));
         }
         else if(T->isBinary
-            && env->settings->getSetting<int>("Reformulation.Monomials.Formulation", "Model")
-                == static_cast<int>(ES_ReformulationBinaryMonomials::CostaLiberti))
+            && monomialFormulation.get() == static_cast<int>(ES_ReformulationBinaryMonomials::CostaLiberti))
         {
             int variableOffset = 0;
             int k = T->variables.size();
@@ -14,6 +14,8 @@
 #include <map>
 #include <tuple>
 
+#include "../Settings.h"
+
 #include "../Model/AuxiliaryVariables.h"
 #include "../Model/Constraints.h"
 #include "../Model/NonlinearExpressions.h"
@@ -48,6 +50,13 @@ private:
     bool partitionQuadraticTermsInObjective = false;
     bool partitionQuadraticTermsInConstraint = false;
 
+    SettingRef<int> objectivePartitioning;
+    SettingRef<int> constraintPartitioning;
+    SettingRef<int> monomialFormulation;
+    SettingRef<int> bilinearIntegerFormulation;
+    SettingRef<double> minimumLowerBound;
+    SettingRef<double> maximumUpperBound;
+
     void reformulateObjectiveFunction();
     NumericConstraints reformulateConstraint(NumericConstraintPtr constraint);
 
@@ -24,6 +24,14 @@ namespace SHOT
 TaskSelectHyperplanePointsECP::TaskSelectHyperplanePointsECP(EnvironmentPtr envPtr) : TaskBase(envPtr)
 {
     env->timing->startTimer("DualCutGenerationRootSearch");
+
+    selectionFactor = env->settings->getSettingRef<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
+    uniqueConstraints = env->settings->getSettingRef<bool>("ESH.Rootsearch.UniqueConstraints", "Dual");
+    maxPerIteration = env->settings->getSettingRef<int>("HyperplaneCuts.MaxPerIteration", "Dual");
+    maxConstraintFactor = env->settings->getSettingRef<double>("HyperplaneCuts.MaxConstraintFactor", "Dual");
+
+    rootsearchTimer = env->timing->getTimerIndex("DualCutGenerationRootSearch");
+
     env->timing->stopTimer("DualCutGenerationRootSearch");
 }
 
@@ -31,23 +39,21 @@ TaskSelectHyperplanePointsECP::~TaskSelectHyperplanePointsECP() = default;
 
 void TaskSelectHyperplanePointsECP::run() { this->run(env->results->getPreviousIteration()->solutionPoints); }
 
-void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
+void TaskSelectHyperplanePointsECP::run(const std::vector<SolutionPoint>& solPoints)
 {
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints == 0)
         return;
 
-    env->timing->startTimer("DualCutGenerationRootSearch");
+    ScopedTimer timer(*env->timing, rootsearchTimer);
 
     int addedHyperplanes = 0;
     auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
 
-    auto constraintSelectionFactor
-        = env->settings->getSetting<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
-    bool useUniqueConstraints = env->settings->getSetting<bool>("ESH.Rootsearch.UniqueConstraints", "Dual");
+    double constraintSelectionFactor = selectionFactor.get();
+    bool useUniqueConstraints = uniqueConstraints.get();
 
-    int maxHyperplanesPerIter = env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual");
-    double constraintMaxSelectionFactor
-        = env->settings->getSetting<double>("HyperplaneCuts.MaxConstraintFactor", "Dual");
+    int maxHyperplanesPerIter = maxPerIteration.get();
+    double constraintMaxSelectionFactor = maxConstraintFactor.get();
 
     // Contains boolean array that indicates if a constraint has been added or not
     std::vector<bool> hyperplaneAddedToConstraint(
@@ -59,15 +65,12 @@ void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
     for(size_t i = 0; i < solPoints.size(); i++)
     {
         auto numericConstraintValues = env->reformulatedProblem->getFractionOfDeviatingNonlinearConstraints(
-            solPoints.at(i).point, 0.0, constraintSelectionFactor);
+            solPoints.at(i), 0.0, constraintSelectionFactor);
 
         for(auto& NCV : numericConstraintValues)
         {
             if(addedHyperplanes >= maxHyperplanesPerIter)
-            {
-                env->timing->stopTimer("DualCutGenerationRootSearch");
                 return;
-            }
 
             // Do not add hyperplane if one has been added for this constraint already
             if(useUniqueConstraints && hyperplaneAddedToConstraint.at(NCV.constraint->index))
@@ -85,12 +88,10 @@ void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
                 continue;
             }
 
-            size_t hash = Utilities::calculateHash(solPoints.at(i).point);
-
-            if(env->dualSolver->hasHyperplaneBeenAdded(hash, NCV.constraint->index))
+            if(env->dualSolver->hasHyperplaneBeenAdded(solPoints.at(i).point, NCV.constraint->index))
             {
-                env->output->outputDebug("    Hyperplane already added for constraint "
-                    + std::to_string(NCV.constraint->index) + " and hash " + std::to_string(hash));
+                env->output->outputDebug(
+                    "    Hyperplane already added for constraint " + std::to_string(NCV.constraint->index));
                 continue;
             }
 
@@ -180,8 +181,6 @@ void TaskSelectHyperplanePointsECP::run(std::vector<SolutionPoint> solPoints)
     {
         env->output->outputDebug("        All nonlinear constraints fulfilled, so no constraint cuts added.");
     }
-
-    env->timing->stopTimer("DualCutGenerationRootSearch");
 }
 
 std::string TaskSelectHyperplanePointsECP::getType()
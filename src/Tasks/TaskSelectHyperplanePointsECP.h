@@ -11,6 +11,7 @@
 #pragma once
 #include "TaskBase.h"
 
+#include "../Settings.h"
 #include "../Structs.h"
 
 namespace SHOT
@@ -22,10 +23,16 @@ public:
     ~TaskSelectHyperplanePointsECP() override;
 
     void run() override;
-    virtual void run(std::vector<SolutionPoint> solPoints);
+    virtual void run(const std::vector<SolutionPoint>& solPoints);
 
     std::string getType() override;
 
 private:
+    SettingRef<double> selectionFactor;
+    SettingRef<bool> uniqueConstraints;
+    SettingRef<int> maxPerIteration;
+    SettingRef<double> maxConstraintFactor;
+
+    int rootsearchTimer;
 };
 } // namespace SHOT
\ No newline at end of file
@@ -11,23 +11,190 @@
 #include "TaskSelectHyperplanePointsESH.h"
 
 #include "../DualSolver.h"
+#include "../Iteration.h"
 #include "../Output.h"
+#include "../PrimalSolver.h"
 #include "../Results.h"
 #include "../Settings.h"
 #include "../Utilities.h"
 #include "../Timing.h"
+#include "../ThreadPool.h"
 
 #include "../Model/Problem.h"
 
 #include "TaskSelectHyperplanePointsECP.h"
 #include "../RootsearchMethod/IRootsearchMethod.h"
 
+#include <map>
+#include <optional>
+
 namespace SHOT
 {
 
+namespace
+{
+    using RootsearchSelection = std::vector<std::tuple<int, int, NumericConstraintValue>>;
+    using RootsearchResult = std::optional<std::pair<VectorDouble, VectorDouble>>;
+    using RootsearchBoundaries = std::map<std::pair<int, int>, double>;
+
+    // Performs the root searches between the interior points and solution points for all selected constraint values.
+    // The searches are independent, so they are run in parallel; the results are in the same order as the selection.
+    // Constraints selected for the same pair of points can be searched on the segment in one pass. The boundaries
+    // found for each constraint and interior point are kept in previousBoundaries, and used to narrow the initial
+    // brackets of the next searches.
+    std::vector<RootsearchResult> performRootsearches(EnvironmentPtr env, ThreadPool& threadPool,
+        const RootsearchSelection& selectedNumericValues, const std::vector<SolutionPoint>& solPoints,
+        RootsearchBoundaries& previousBoundaries)
+    {
+        std::vector<RootsearchResult> results(selectedNumericValues.size());
+
+        if(selectedNumericValues.size() == 0)
+            return (results);
+
+        int rootMaxIter = env->settings->getSetting<int>("Rootsearch.MaxIterations", "Subsolver");
+        double rootTerminationTolerance
+            = env->settings->getSetting<double>("Rootsearch.TerminationTolerance", "Subsolver");
+        double rootActiveConstraintTolerance
+            = env->settings->getSetting<double>("Rootsearch.ActiveConstraintTolerance", "Subsolver");
+        bool searchMultipleConstraints
+            = env->settings->getSetting<bool>("ESH.Rootsearch.MultipleConstraints", "Dual");
+        double warmStartWidth = env->settings->getSetting<double>("ESH.Rootsearch.WarmStartWidth", "Dual");
+
+        // The previous boundaries are only read and updated outside of the parallel searches
+        std::vector<RootsearchWarmStart> warmStarts(selectedNumericValues.size());
+
+        for(size_t k = 0; k < selectedNumericValues.size(); k++)
+        {
+            if(warmStartWidth <= 0.0)
+                break;
+
+            auto key = std::make_pair(
+                std::get<2>(selectedNumericValues[k]).constraint->index, std::get<1>(selectedNumericValues[k]));
+
+            if(auto boundary = previousBoundaries.find(key); boundary != previousBoundaries.end())
+            {
+                warmStarts[k].previousLambda = boundary->second;
+                warmStarts[k].width = warmStartWidth;
+            }
+        }
+
+        auto& statistics = env->solutionStatistics;
+        int previousNumberOfRootsearches = statistics.numberOfRootsearches;
+        int previousNumberOfWarmStartedRootsearches = statistics.numberOfWarmStartedRootsearches;
+        int previousNumberOfFunctionEvaluations = statistics.numberOfRootsearchFunctionEvaluations;
+        int previousNumberOfFunctionEvaluationsSaved = statistics.numberOfRootsearchFunctionEvaluationsSaved;
+
+        // The sparsity patterns are created on first use, which is not thread-safe
+        for(auto& values : selectedNumericValues)
+            std::get<2>(values).constraint->getGradientSparsityPattern();
+
+        // Each search is given by the indices of its constraint values in the selection
+        std::vector<std::vector<size_t>> searches;
+        std::map<std::pair<int, int>, size_t> searchForSegment;
+
+        for(size_t k = 0; k < selectedNumericValues.size(); k++)
+        {
+            if(std::get<2>(selectedNumericValues[k]).error <= 0.0)
+                continue;
+
+            auto segment = std::make_pair(std::get<0>(selectedNumericValues[k]), std::get<1>(selectedNumericValues[k]));
+            auto search = searchForSegment.find(segment);
+
+            if(searchMultipleConstraints && search != searchForSegment.end())
+            {
+                searches[search->second].push_back(k);
+                continue;
+            }
+
+            searchForSegment.emplace(segment, searches.size());
+            searches.push_back({ k });
+        }
+
+        threadPool.parallelFor(searches.size(), [&](size_t s) {
+            auto& search = searches[s];
+
+            int i = std::get<0>(selectedNumericValues[search[0]]);
+            int j = std::get<1>(selectedNumericValues[search[0]]);
+
+            std::vector<NumericConstraint*> constraints;
+
+            for(auto k : search)
+                constraints.push_back(
+                    std::dynamic_pointer_cast<NumericConstraint>(std::get<2>(selectedNumericValues[k]).constraint)
+                        .get());
+
+            try
+            {
+                if(constraints.size() == 1)
+                {
+                    // The primal candidates are added when the results are merged, since the primal solver is not
+                    // thread-safe
+                    results[search[0]] = env->rootsearchMethod->findZero(env->dualSolver->interiorPts.at(j)->point,
+                        solPoints.at(i).point, rootMaxIter, rootTerminationTolerance, rootActiveConstraintTolerance,
+                        constraints, false, warmStarts[search[0]]);
+                }
+                else
+                {
+                    std::vector<RootsearchWarmStart> searchWarmStarts;
+
+                    for(auto k : search)
+                        searchWarmStarts.push_back(warmStarts[k]);
+
+                    auto boundaries = env->rootsearchMethod->findZeros(env->dualSolver->interiorPts.at(j)->point,
+                        solPoints.at(i).point, rootMaxIter, rootTerminationTolerance, constraints, searchWarmStarts);
+
+                    for(size_t l = 0; l < search.size(); l++)
+                    {
+                        results[search[l]] = boundaries[l];
+                        warmStarts[search[l]] = searchWarmStarts[l];
+                    }
+                }
+            }
+            catch(std::exception&)
+            {
+                for(auto k : search)
+                {
+                    results[k].reset();
+                    warmStarts[k].lambda.reset();
+                }
+            }
+        });
+
+        for(size_t k = 0; k < selectedNumericValues.size(); k++)
+        {
+            if(!warmStarts[k].lambda)
+                continue;
+
+            auto key = std::make_pair(
+                std::get<2>(selectedNumericValues[k]).constraint->index, std::get<1>(selectedNumericValues[k]));
+            previousBoundaries[key] = *warmStarts[k].lambda;
+        }
+
+        auto currIter = env->results->getCurrentIteration();
+        currIter->numberOfRootsearches += statistics.numberOfRootsearches - previousNumberOfRootsearches;
+        currIter->numberOfWarmStartedRootsearches
+            += statistics.numberOfWarmStartedRootsearches - previousNumberOfWarmStartedRootsearches;
+        currIter->numberOfRootsearchFunctionEvaluations
+            += statistics.numberOfRootsearchFunctionEvaluations - previousNumberOfFunctionEvaluations;
+        currIter->numberOfRootsearchFunctionEvaluationsSaved
+            += statistics.numberOfRootsearchFunctionEvaluationsSaved - previousNumberOfFunctionEvaluationsSaved;
+
+        return (results);
+    }
+} // namespace
+
 TaskSelectHyperplanePointsESH::TaskSelectHyperplanePointsESH(EnvironmentPtr envPtr) : TaskBase(envPtr)
 {
     env->timing->startTimer("DualCutGenerationRootSearch");
+
+    selectionFactor = env->settings->getSettingRef<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
+    uniqueConstraints = env->settings->getSettingRef<bool>("ESH.Rootsearch.UniqueConstraints", "Dual");
+    maxPerIteration = env->settings->getSettingRef<int>("HyperplaneCuts.MaxPerIteration", "Dual");
+    maxConstraintFactor = env->settings->getSettingRef<double>("HyperplaneCuts.MaxConstraintFactor", "Dual");
+    rootsearchTolerance = env->settings->getSettingRef<double>("ESH.Rootsearch.ConstraintTolerance", "Dual");
+
+    rootsearchTimer = env->timing->getTimerIndex("DualCutGenerationRootSearch");
+
     env->timing->stopTimer("DualCutGenerationRootSearch");
 }
 
@@ -35,12 +202,12 @@ TaskSelectHyperplanePointsESH::~TaskSelectHyperplanePointsESH() = default;
 
 void TaskSelectHyperplanePointsESH::run() { this->run(env->results->getPreviousIteration()->solutionPoints); }
 
-void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
+void TaskSelectHyperplanePointsESH::run(const std::vector<SolutionPoint>& solPoints)
 {
     if(env->reformulatedProblem->properties.numberOfNonlinearConstraints == 0)
         return;
 
-    env->timing->startTimer("DualCutGenerationRootSearch");
+    ScopedTimer timer(*env->timing, rootsearchTimer);
 
     if(env->dualSolver->interiorPts.size() == 0)
     {
@@ -52,27 +219,18 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
         env->output->outputDebug("        Adding cutting plane since no interior point is known.");
         tSelectHPPts->run(solPoints);
-
-        env->timing->stopTimer("DualCutGenerationRootSearch");
         return;
     }
 
     int addedHyperplanes = 0;
     auto currIter = env->results->getCurrentIteration(); // The unsolved new iteration
 
-    auto constraintSelectionFactor
-        = env->settings->getSetting<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
-    bool useUniqueConstraints = env->settings->getSetting<bool>("ESH.Rootsearch.UniqueConstraints", "Dual");
+    double constraintSelectionFactor = selectionFactor.get();
+    bool useUniqueConstraints = uniqueConstraints.get();
 
-    int rootMaxIter = env->settings->getSetting<int>("Rootsearch.MaxIterations", "Subsolver");
-    double rootTerminationTolerance = env->settings->getSetting<double>("Rootsearch.TerminationTolerance", "Subsolver");
-    double rootActiveConstraintTolerance
-        = env->settings->getSetting<double>("Rootsearch.ActiveConstraintTolerance", "Subsolver");
-    int maxHyperplanesPerIter = env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual");
-    double rootsearchConstraintTolerance
-        = env->settings->getSetting<double>("ESH.Rootsearch.ConstraintTolerance", "Dual");
-    double constraintMaxSelectionFactor
-        = env->settings->getSetting<double>("HyperplaneCuts.MaxConstraintFactor", "Dual");
+    int maxHyperplanesPerIter = maxPerIteration.get();
+    double rootsearchConstraintTolerance = rootsearchTolerance.get();
+    double constraintMaxSelectionFactor = maxConstraintFactor.get();
 
     // Contains boolean array that indicates if a constraint has been added or not
     std::vector<bool> hyperplaneAddedToConstraint(
@@ -81,10 +239,14 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
     std::vector<std::tuple<int, int, NumericConstraintValue>> selectedNumericValues;
     std::vector<std::tuple<int, int, NumericConstraintValue>> nonconvexSelectedNumericValues;
 
+    // The constraint values stored with the points from the MIP solution pool are used, otherwise they are calculated
+    // for all solution points at once
+    auto deviatingConstraintValues = env->reformulatedProblem->getFractionOfDeviatingNonlinearConstraints(
+        solPoints, 0.0, constraintSelectionFactor);
+
     for(size_t i = 0; i < solPoints.size(); i++)
     {
-        auto numericConstraintValues = env->reformulatedProblem->getFractionOfDeviatingNonlinearConstraints(
-            solPoints.at(i).point, 0.0, constraintSelectionFactor);
+        auto& numericConstraintValues = deviatingConstraintValues.at(i);
 
         if(numericConstraintValues.size() == 0)
         {
@@ -96,10 +258,7 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
             for(size_t j = 0; j < env->dualSolver->interiorPts.size(); j++)
             {
                 if(addedHyperplanes >= maxHyperplanesPerIter)
-                {
-                    env->timing->stopTimer("DualCutGenerationRootSearch");
                     break;
-                }
 
                 // Do not add hyperplane if one has been added for this constraint already
                 if(useUniqueConstraints && hyperplaneAddedToConstraint.at(NCV.constraint->index))
@@ -135,11 +294,18 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
         }
     }
 
-    for(auto& values : selectedNumericValues)
+    if(!threadPool)
+        threadPool = std::make_unique<ThreadPool>(
+            env->settings->getSetting<int>("ESH.Rootsearch.NumberOfThreads", "Dual"));
+
+    auto rootsearchResults = performRootsearches(
+        env, *threadPool, selectedNumericValues, solPoints, previousRootsearchBoundaries);
+
+    // The results are merged in the same order as if the root searches had been performed one by one
+    for(size_t k = 0; k < selectedNumericValues.size(); k++)
     {
-        int i = std::get<0>(values);
-        int j = std::get<1>(values);
-        auto NCV = std::get<2>(values);
+        int i = std::get<0>(selectedNumericValues[k]);
+        auto NCV = std::get<2>(selectedNumericValues[k]);
 
         if(NCV.error <= 0.0)
             continue;
@@ -147,23 +313,16 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
         VectorDouble externalPoint;
         VectorDouble internalPoint;
 
-        std::vector<NumericConstraint*> currentConstraint;
-        currentConstraint.push_back(std::dynamic_pointer_cast<NumericConstraint>(NCV.constraint).get());
-
-        try
+        if(auto& xNewc = rootsearchResults[k])
         {
-            env->timing->startTimer("DualCutGenerationRootSearch");
-            auto xNewc
-                = env->rootsearchMethod->findZero(env->dualSolver->interiorPts.at(j)->point, solPoints.at(i).point,
-                    rootMaxIter, rootTerminationTolerance, rootActiveConstraintTolerance, currentConstraint, true);
-
-            env->timing->stopTimer("DualCutGenerationRootSearch");
-            internalPoint = xNewc.first;
-            externalPoint = xNewc.second;
+            env->primalSolver->addPrimalSolutionCandidate(
+                xNewc->first, E_PrimalSolutionSource::Rootsearch, currIter->iterationNumber);
+
+            internalPoint = xNewc->first;
+            externalPoint = xNewc->second;
         }
-        catch(std::exception& e)
+        else
         {
-            env->timing->stopTimer("DualCutGenerationRootSearch");
             externalPoint = solPoints.at(i).point;
 
             env->output->outputDebug("     Cannot find solution with rootsearch, using solution point instead.");
@@ -173,12 +332,10 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
         if(externalConstraintValue.normalizedValue >= 0)
         {
-            size_t hash = Utilities::calculateHash(externalPoint);
-
-            if(env->dualSolver->hasHyperplaneBeenAdded(hash, externalConstraintValue.constraint->index))
+            if(env->dualSolver->hasHyperplaneBeenAdded(externalPoint, externalConstraintValue.constraint->index))
             {
                 env->output->outputDebug("    Hyperplane already added for constraint "
-                    + std::to_string(externalConstraintValue.constraint->index) + " and hash " + std::to_string(hash));
+                    + std::to_string(externalConstraintValue.constraint->index));
                 continue;
             }
 
@@ -222,14 +379,16 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
 
     if(addedHyperplanes == 0)
     {
-        for(auto& values : nonconvexSelectedNumericValues)
+        rootsearchResults = performRootsearches(
+            env, *threadPool, nonconvexSelectedNumericValues, solPoints, previousRootsearchBoundaries);
+
+        for(size_t k = 0; k < nonconvexSelectedNumericValues.size(); k++)
         {
             if(addedHyperplanes > maxHyperplanesPerIter)
                 break;
 
-            int i = std::get<0>(values);
-            int j = std::get<1>(values);
-            auto NCV = std::get<2>(values);
+            int i = std::get<0>(nonconvexSelectedNumericValues[k]);
+            auto NCV = std::get<2>(nonconvexSelectedNumericValues[k]);
 
             if(NCV.error <= 0.0)
                 continue;
@@ -237,39 +396,30 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
             VectorDouble externalPoint;
             VectorDouble internalPoint;
 
-            std::vector<NumericConstraint*> currentConstraint;
-            currentConstraint.push_back(std::dynamic_pointer_cast<NumericConstraint>(NCV.constraint).get());
-
-            try
+            if(auto& xNewc = rootsearchResults[k])
             {
-                env->timing->startTimer("DualCutGenerationRootSearch");
-                auto xNewc
-                    = env->rootsearchMethod->findZero(env->dualSolver->interiorPts.at(j)->point, solPoints.at(i).point,
-                        rootMaxIter, rootTerminationTolerance, rootActiveConstraintTolerance, currentConstraint, true);
-
-                env->timing->stopTimer("DualCutGenerationRootSearch");
-                internalPoint = xNewc.first;
-                externalPoint = xNewc.second;
+                env->primalSolver->addPrimalSolutionCandidate(
+                    xNewc->first, E_PrimalSolutionSource::Rootsearch, currIter->iterationNumber);
+
+                internalPoint = xNewc->first;
+                externalPoint = xNewc->second;
             }
-            catch(std::exception& e)
+            else
             {
-                env->timing->stopTimer("DualCutGenerationRootSearch");
                 externalPoint = solPoints.at(i).point;
 
-                env->output->outputDebug("     Cannot find solution with rootsearch, using solution point instead.");
+                env->output->outputDebug(
+                    "     Cannot find solution with rootsearch, using solution point instead.");
             }
 
             auto externalConstraintValue = NCV.constraint->calculateNumericValue(externalPoint);
 
             if(externalConstraintValue.normalizedValue >= 0)
             {
-                size_t hash = Utilities::calculateHash(externalPoint);
-
-                if(env->dualSolver->hasHyperplaneBeenAdded(hash, externalConstraintValue.constraint->index))
+                if(env->dualSolver->hasHyperplaneBeenAdded(externalPoint, externalConstraintValue.constraint->index))
                 {
                     env->output->outputDebug("    Hyperplane already added for constraint "
-                        + std::to_string(externalConstraintValue.constraint->index) + " and hash "
-                        + std::to_string(hash));
+                        + std::to_string(externalConstraintValue.constraint->index));
                     continue;
                 }
 
@@ -317,8 +467,6 @@ void TaskSelectHyperplanePointsESH::run(std::vector<SolutionPoint> solPoints)
     {
         env->output->outputDebug("        All nonlinear constraints fulfilled, so no constraint cuts added.");
     }
-
-    env->timing->stopTimer("DualCutGenerationRootSearch");
 }
 
 std::string TaskSelectHyperplanePointsESH::getType()
@@ -11,11 +11,16 @@
 #pragma once
 #include "TaskBase.h"
 
+#include "../Settings.h"
+
+#include <map>
+
 namespace SHOT
 {
 
 class Constraint;
 class TaskSelectHyperplanePointsECP;
+class ThreadPool;
 
 class TaskSelectHyperplanePointsESH : public TaskBase
 {
@@ -24,7 +29,7 @@ public:
     ~TaskSelectHyperplanePointsESH() override;
 
     void run() override;
-    virtual void run(std::vector<SolutionPoint> solPoints);
+    virtual void run(const std::vector<SolutionPoint>& solPoints);
 
     std::string getType() override;
 
@@ -32,5 +37,19 @@ private:
     std::unique_ptr<TaskSelectHyperplanePointsECP> tSelectHPPts;
     bool hyperplaneSolutionPointStrategyInitialized = false;
     std::vector<Constraint*> nonlinearConstraints;
+
+    // For the root searches, created on the first call to run
+    std::unique_ptr<ThreadPool> threadPool;
+
+    // The parameter of the boundary found in the last root search for each constraint and interior point
+    std::map<std::pair<int, int>, double> previousRootsearchBoundaries;
+
+    SettingRef<double> selectionFactor;
+    SettingRef<bool> uniqueConstraints;
+    SettingRef<int> maxPerIteration;
+    SettingRef<double> maxConstraintFactor;
+    SettingRef<double> rootsearchTolerance;
+
+    int rootsearchTimer;
 };
 } // namespace SHOT
\ No newline at end of file
@@ -22,6 +22,7 @@ namespace SHOT
 TaskSelectPrimalCandidatesFromSolutionPool::TaskSelectPrimalCandidatesFromSolutionPool(EnvironmentPtr envPtr)
     : TaskBase(envPtr)
 {
+    primalStrategyTimer = env->timing->getTimerIndex("PrimalStrategy");
 }
 
 TaskSelectPrimalCandidatesFromSolutionPool::~TaskSelectPrimalCandidatesFromSolutionPool() = default;
@@ -30,11 +31,9 @@ void TaskSelectPrimalCandidatesFromSolutionPool::run()
 {
     auto currIter = env->results->getCurrentIteration();
 
-    env->timing->startTimer("PrimalStrategy");
-    auto allSolutions = env->results->getCurrentIteration()->solutionPoints;
+    ScopedTimer timer(*env->timing, primalStrategyTimer);
+    auto& allSolutions = env->results->getCurrentIteration()->solutionPoints;
     env->primalSolver->addPrimalSolutionCandidates(allSolutions, E_PrimalSolutionSource::MIPSolutionPool);
-
-    env->timing->stopTimer("PrimalStrategy");
 }
 
 std::string TaskSelectPrimalCandidatesFromSolutionPool::getType()
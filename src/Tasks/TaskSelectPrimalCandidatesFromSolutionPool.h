@@ -23,5 +23,6 @@ public:
     std::string getType() override;
 
 private:
+    int primalStrategyTimer;
 };
 } // namespace SHOT
\ No newline at end of file
@@ -22,17 +22,19 @@ namespace SHOT
 TaskSelectPrimalFixedNLPPointsFromSolutionPool::TaskSelectPrimalFixedNLPPointsFromSolutionPool(EnvironmentPtr envPtr)
     : TaskBase(envPtr)
 {
+    primalStrategyTimer = env->timing->getTimerIndex("PrimalStrategy");
+    primalNLPTimer = env->timing->getTimerIndex("PrimalBoundStrategyNLP");
 }
 
 TaskSelectPrimalFixedNLPPointsFromSolutionPool::~TaskSelectPrimalFixedNLPPointsFromSolutionPool() = default;
 
 void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
 {
-    env->timing->startTimer("PrimalStrategy");
-    env->timing->startTimer("PrimalBoundStrategyNLP");
+    ScopedTimer strategyTimer(*env->timing, primalStrategyTimer);
+    ScopedTimer NLPTimer(*env->timing, primalNLPTimer);
 
     auto currIter = env->results->getCurrentIteration();
-    auto allSolutions = env->results->getCurrentIteration()->solutionPoints;
+    auto& allSolutions = env->results->getCurrentIteration()->solutionPoints;
 
     bool callNLPSolver = false;
     bool useFeasibleSolutionExtra = false;
@@ -132,7 +134,7 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
 
         for(size_t i = 1; i < allSolutions.size(); i++)
         {
-            auto tmpSol = allSolutions.at(i);
+            auto& tmpSol = allSolutions.at(i);
 
             if(tmpSol.maxDeviation.value
                 <= env->settings->getSetting<double>("Tolerance.NonlinearConstraint", "Primal"))
@@ -166,11 +168,6 @@ void TaskSelectPrimalFixedNLPPointsFromSolutionPool::run()
             }
         }
     }
-    else
-    {
-        env->timing->stopTimer("PrimalBoundStrategyNLP");
-        env->timing->stopTimer("PrimalStrategy");
-    }
 }
 
 std::string TaskSelectPrimalFixedNLPPointsFromSolutionPool::getType()
@@ -23,5 +23,7 @@ public:
     std::string getType() override;
 
 private:
+    int primalStrategyTimer;
+    int primalNLPTimer;
 };
 } // namespace SHOT
\ No newline at end of file
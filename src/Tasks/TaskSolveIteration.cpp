@@ -146,7 +146,7 @@ void TaskSolveIteration::run()
     currIter->solutionStatus = solStatus;
     env->output->outputDebug("     Dual problem return code: " + std::to_string((int)solStatus));
 
-    auto sols = env->dualSolver->MIPSolver->getAllVariableSolutions();
+    auto& sols = env->dualSolver->MIPSolver->getAllVariableSolutions();
 
     if(sols.size() > 0)
     {
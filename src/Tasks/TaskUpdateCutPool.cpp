@@ -0,0 +1,45 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "TaskUpdateCutPool.h"
+
+#include "../DualSolver.h"
+#include "../Iteration.h"
+#include "../Results.h"
+#include "../Timing.h"
+
+namespace SHOT
+{
+
+TaskUpdateCutPool::TaskUpdateCutPool(EnvironmentPtr envPtr) : TaskBase(envPtr) {}
+
+TaskUpdateCutPool::~TaskUpdateCutPool() = default;
+
+void TaskUpdateCutPool::run()
+{
+    auto currIter = env->results->getCurrentIteration();
+
+    if(currIter->solutionPoints.size() == 0)
+        return;
+
+    env->timing->startTimer("DualStrategy");
+
+    // The first solution point is the optimal one for the dual problem
+    env->dualSolver->updateCutPool(currIter->solutionPoints.at(0).point);
+
+    env->timing->stopTimer("DualStrategy");
+}
+
+std::string TaskUpdateCutPool::getType()
+{
+    std::string type = typeid(this).name();
+    return (type);
+}
+} // namespace SHOT
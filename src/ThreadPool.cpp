@@ -0,0 +1,146 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace SHOT
+{
+
+ThreadPool::ThreadPool(int numberOfThreads)
+{
+    if(numberOfThreads <= 0)
+        numberOfThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // The calling thread uses the first range
+    for(int i = 0; i < numberOfThreads; i++)
+        ranges.push_back(std::make_unique<TaskRange>());
+
+    for(int i = 1; i < numberOfThreads; i++)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    workAvailable.notify_all();
+
+    for(auto& W : workers)
+        W.join();
+}
+
+void ThreadPool::parallelFor(size_t numberOfTasks, const std::function<void(size_t)>& task)
+{
+    if(numberOfTasks == 0)
+        return;
+
+    if(workers.size() == 0 || numberOfTasks == 1)
+    {
+        for(size_t i = 0; i < numberOfTasks; i++)
+            task(i);
+
+        return;
+    }
+
+    size_t numberOfRanges = ranges.size();
+
+    for(size_t i = 0; i < numberOfRanges; i++)
+    {
+        std::lock_guard<std::mutex> lock(ranges[i]->mutex);
+        ranges[i]->begin = i * numberOfTasks / numberOfRanges;
+        ranges[i]->end = (i + 1) * numberOfTasks / numberOfRanges;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        numberOfBusyWorkers = workers.size();
+        generation++;
+    }
+
+    workAvailable.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    workFinished.wait(lock, [this] { return (numberOfBusyWorkers == 0); });
+    currentTask = nullptr;
+}
+
+bool ThreadPool::takeTask(size_t rangeIndex, size_t& taskIndex)
+{
+    // First from the beginning of the own range
+    {
+        auto& range = *ranges[rangeIndex];
+        std::lock_guard<std::mutex> lock(range.mutex);
+
+        if(range.begin < range.end)
+        {
+            taskIndex = range.begin++;
+            return (true);
+        }
+    }
+
+    // Then from the end of the ranges of the other threads
+    for(size_t i = 1; i < ranges.size(); i++)
+    {
+        auto& range = *ranges[(rangeIndex + i) % ranges.size()];
+        std::lock_guard<std::mutex> lock(range.mutex);
+
+        if(range.begin < range.end)
+        {
+            taskIndex = --range.end;
+            return (true);
+        }
+    }
+
+    return (false);
+}
+
+void ThreadPool::work(size_t rangeIndex)
+{
+    size_t taskIndex;
+
+    while(takeTask(rangeIndex, taskIndex))
+        (*currentTask)(taskIndex);
+}
+
+void ThreadPool::workerLoop(size_t rangeIndex)
+{
+    size_t finishedGeneration = 0;
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [&] { return (stopping || generation != finishedGeneration); });
+
+            if(stopping)
+                return;
+
+            finishedGeneration = generation;
+        }
+
+        work(rangeIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            numberOfBusyWorkers--;
+        }
+
+        workFinished.notify_one();
+    }
+}
+} // namespace SHOT
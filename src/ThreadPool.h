@@ -0,0 +1,67 @@
+/**
+   The Supporting Hyperplane Optimization Toolkit (SHOT).
+
+   @author Andreas Lundell, Åbo Akademi University
+
+   @section LICENSE
+   This software is licensed under the Eclipse Public License 2.0.
+   Please see the README and LICENSE files for more information.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SHOT
+{
+
+// A fixed set of worker threads for running independent tasks in parallel. The tasks of a call to parallelFor are
+// divided into one range per thread; a thread that has finished its own range steals tasks from the end of the
+// ranges of the other threads.
+class ThreadPool
+{
+public:
+    // Uses the number of hardware threads if numberOfThreads is zero
+    ThreadPool(int numberOfThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // The number of threads used, including the calling thread
+    inline int getNumberOfThreads() const { return (static_cast<int>(workers.size()) + 1); }
+
+    // Calls task(i) for i = 0, ..., numberOfTasks - 1 and returns when all calls have finished. The calling thread
+    // also performs tasks. The task must not throw.
+    void parallelFor(size_t numberOfTasks, const std::function<void(size_t)>& task);
+
+private:
+    struct TaskRange
+    {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    void work(size_t rangeIndex);
+    bool takeTask(size_t rangeIndex, size_t& taskIndex);
+    void workerLoop(size_t rangeIndex);
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<TaskRange>> ranges;
+
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workFinished;
+
+    const std::function<void(size_t)>* currentTask = nullptr;
+    size_t generation = 0;
+    size_t numberOfBusyWorkers = 0;
+    bool stopping = false;
+};
+} // namespace SHOT
@@ -22,6 +22,7 @@ public:
     {
         restart();
         isRunning = false;
+        numberOfCalls = 0;
         description = "";
         name = timerName;
     }
@@ -30,6 +31,7 @@ public:
     {
         restart();
         isRunning = false;
+        numberOfCalls = 0;
         description = desc;
         name = timerName;
     }
@@ -51,6 +53,7 @@ public:
     {
         isRunning = true;
         timeElapsed = 0.0;
+        numberOfCalls = 1;
         lastStart = std::chrono::high_resolution_clock::now();
     }
 
@@ -73,13 +76,23 @@ public:
         }
 
         isRunning = true;
+        numberOfCalls++;
         lastStart = std::chrono::high_resolution_clock::now();
     }
 
+    inline bool running() const { return (isRunning); }
+
+    // The number of times the timer has been started
+    inline int getNumberOfCalls() const { return (numberOfCalls); }
+
     std::string description;
     std::string name;
 
+    // The index of the timer this timer is a part of, or -1 if it has none
+    int parent = -1;
+
 private:
+    int numberOfCalls = 0;
     double timeElapsed;
     bool isRunning;
 };
@@ -13,6 +13,8 @@
 #include "Timer.h"
 
 #include <algorithm>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace SHOT
@@ -25,64 +27,131 @@ public:
 
     inline ~Timing() { timers.clear(); }
 
-    inline void createTimer(std::string name, std::string description) { timers.emplace_back(name, description); }
+    // Creates a timer and returns its index, which can be used instead of the name in code that is called often. The
+    // parent is the timer whose time the new timer is a part of, and is used for the breakdown in the final report. If
+    // a timer with the name already exists, its index is returned.
+    inline int createTimer(const std::string& name, const std::string& description, const std::string& parent = "")
+    {
+        if(auto existingIndex = getTimerIndex(name); existingIndex >= 0)
+            return (existingIndex);
+
+        int index = static_cast<int>(timers.size());
+
+        timers.emplace_back(name, description);
+        timers.back().parent = getTimerIndex(parent);
+        timerIndexes.emplace(name, index);
 
-    inline void startTimer(std::string name)
+        return (index);
+    }
+
+    // Returns -1 if the timer does not exist, in which case the calls with the index do nothing
+    inline int getTimerIndex(const std::string& name) const
     {
-        auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
+        auto timer = timerIndexes.find(name);
 
-        if(timer == timers.end())
-        {
-            // env->output->outputError("Timer with name  \"" + name + "\" not found!");
-            return;
-        }
+        if(timer == timerIndexes.end())
+            return (-1);
 
-        timer->start();
+        return (timer->second);
     }
 
-    inline void stopTimer(std::string name)
+    inline void startTimer(int index)
     {
-        auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
+        if(index >= 0)
+            timers[index].start();
+    }
 
-        if(timer == timers.end())
-        {
-            // env->output->outputError("Timer with name  \"" + name + "\" not found!");
-            return;
-        }
+    inline void stopTimer(int index)
+    {
+        if(index >= 0)
+            timers[index].stop();
+    }
 
-        timer->stop();
+    inline void restartTimer(int index)
+    {
+        if(index >= 0)
+            timers[index].restart();
     }
 
-    inline void restartTimer(std::string name)
+    inline double getElapsedTime(int index) { return (index >= 0 ? timers[index].elapsed() : 0.0); }
+
+    inline bool isTimerRunning(int index) const { return (index >= 0 && timers[index].running()); }
+
+    inline void startTimer(const std::string& name) { startTimer(getTimerIndex(name)); }
+
+    inline void stopTimer(const std::string& name) { stopTimer(getTimerIndex(name)); }
+
+    inline void restartTimer(const std::string& name) { restartTimer(getTimerIndex(name)); }
+
+    inline double getElapsedTime(const std::string& name) { return (getElapsedTime(getTimerIndex(name))); }
+
+    // The depth of the timer in the breakdown, i.e. the number of timers it is a part of
+    inline int getTimerDepth(int index) const
     {
-        auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
+        int depth = 0;
 
-        if(timer == timers.end())
-        {
-            // env->output->outputError("Timer with name  \"" + name + "\" not found!");
-            return;
-        }
+        for(int parent = timers[index].parent; parent >= 0; parent = timers[parent].parent)
+            depth++;
 
-        timer->restart();
+        return (depth);
     }
 
-    inline double getElapsedTime(std::string name)
+    // The indexes of the timers ordered so that each timer is directly followed by the timers that are a part of it
+    inline std::vector<int> getTimerHierarchy() const
     {
-        auto timer = std::find_if(timers.begin(), timers.end(), [name](Timer const& T) { return (T.name == name); });
+        std::vector<int> order;
+        order.reserve(timers.size());
 
-        if(timer == timers.end())
-        {
-            // env->output->outputError("Timer with name  \"" + name + "\" not found!");
-            return (0.0);
-        }
+        addTimersToHierarchy(-1, order);
 
-        return (timer->elapsed());
+        return (order);
     }
 
     std::vector<Timer> timers;
 
 private:
     EnvironmentPtr env;
+
+    std::unordered_map<std::string, int> timerIndexes;
+
+    inline void addTimersToHierarchy(int parent, std::vector<int>& order) const
+    {
+        for(size_t i = 0; i < timers.size(); i++)
+        {
+            if(timers[i].parent != parent)
+                continue;
+
+            order.push_back(static_cast<int>(i));
+            addTimersToHierarchy(static_cast<int>(i), order);
+        }
+    }
+};
+
+// Starts a timer when created and stops it when destroyed, so that the timer is stopped on all paths out of a scope. If
+// the timer is already running when the scope is entered, it is left to the code that started it, so that the same
+// timer can be used in nested scopes.
+class ScopedTimer
+{
+public:
+    inline ScopedTimer(Timing& timingRef, int timerIndex) : timing(timingRef), index(timerIndex)
+    {
+        if(timing.isTimerRunning(index))
+        {
+            index = -1;
+            return;
+        }
+
+        timing.startTimer(index);
+    }
+
+    inline ~ScopedTimer() { timing.stopTimer(index); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Timing& timing;
+    int index;
 };
 
-} // namespace SHOT
\ No newline at end of file
+} // namespace SHOT
@@ -15,6 +15,7 @@
 #include <limits>
 
 #include "Utilities.h"
+#include "Model/Variables.h"
 
 #include <boost/functional/hash/hash.hpp>
 
@@ -498,6 +499,19 @@ std::size_t calculateHash(VectorDouble const& point)
     return (seed);
 }
 
+std::size_t calculateHash(VectorDouble const& point, double tolerance)
+{
+    if(tolerance <= 0.0)
+        return (calculateHash(point));
+
+    std::size_t seed = 0;
+
+    for(auto& X : point)
+        boost::hash_combine(seed, std::round(X / tolerance));
+
+    return (seed);
+}
+
 bool isAlmostEqual(double x, double y, const double epsilon) { return std::abs(x - y) <= epsilon * std::abs(x); }
 
 std::string trim(const std::string& str)
@@ -521,29 +535,8 @@ bool isInteger(double value)
 
 SparseVariableVector combineSparseVariableVectors(const SparseVariableVector& first, const SparseVariableVector& second)
 {
-    SparseVariableVector result;
-
-    for(auto& G : first)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
-
-    for(auto& G : second)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
+    SparseVariableVector result = first;
+    result.add(second);
 
     return result;
 }
@@ -551,40 +544,9 @@ SparseVariableVector combineSparseVariableVectors(const SparseVariableVector& fi
 SparseVariableVector combineSparseVariableVectors(
     const SparseVariableVector& first, const SparseVariableVector& second, const SparseVariableVector& third)
 {
-    SparseVariableVector result;
-
-    for(auto& G : first)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
-
-    for(auto& G : second)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
-
-    for(auto& G : third)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
+    SparseVariableVector result = first;
+    result.add(second);
+    result.add(third);
 
     return result;
 }
@@ -592,29 +554,8 @@ SparseVariableVector combineSparseVariableVectors(
 SparseVariableMatrix combineSparseVariableMatrices(
     const SparseVariableMatrix& first, const SparseVariableMatrix& second)
 {
-    SparseVariableMatrix result;
-
-    for(auto& G : first)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
-
-    for(auto& G : second)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
+    SparseVariableMatrix result = first;
+    result.add(second);
 
     return result;
 }
@@ -622,40 +563,9 @@ SparseVariableMatrix combineSparseVariableMatrices(
 SparseVariableMatrix combineSparseVariableMatrices(
     const SparseVariableMatrix& first, const SparseVariableMatrix& second, const SparseVariableMatrix& third)
 {
-    SparseVariableMatrix result;
-
-    for(auto& G : first)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
-
-    for(auto& G : second)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
-
-    for(auto& G : third)
-    {
-        auto element = result.emplace(G.first, G.second);
-
-        if(!element.second)
-        {
-            // Element already exists for the variable
-            element.first->second += G.second;
-        }
-    }
+    SparseVariableMatrix result = first;
+    result.add(second);
+    result.add(third);
 
     return result;
 }
@@ -17,13 +17,14 @@
 #include <vector>
 
 #include "Structs.h"
+#include "Model/SparseVector.h"
 
 namespace SHOT
 {
 class Variable;
 using VariablePtr = std::shared_ptr<Variable>;
-using SparseVariableVector = std::map<VariablePtr, double>;
-using SparseVariableMatrix = std::map<std::pair<VariablePtr, VariablePtr>, double>;
+using SparseVariableVector = SparseVector<VariablePtr>;
+using SparseVariableMatrix = SparseVector<std::pair<VariablePtr, VariablePtr>>;
 }
 
 namespace SHOT::Utilities
@@ -107,8 +108,17 @@ template <typename K, typename V> inline void erase_if(std::map<K, V>& mapOfElem
     }
 }
 
+template <typename K, typename V> inline void erase_if(SparseVector<K>& sparseVector, V value)
+{
+    sparseVector.eraseValue(value);
+}
+
 std::size_t calculateHash(VectorDouble const& point);
 
+// The values are rounded to multiples of the tolerance before hashing, so that points that differ less than the
+// tolerance usually get the same hash
+std::size_t calculateHash(VectorDouble const& point, double tolerance);
+
 bool isAlmostEqual(double x, double y, const double epsilon);
 
 bool isInteger(double value);
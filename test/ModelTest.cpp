@@ -31,6 +31,692 @@ bool ModelTestCreateProblem();
 bool ModelTestCreateProblem2();
 bool ModelTestCreateProblem3();
 bool ModelTestConvexity();
+bool ModelTestExpressionTape();
+
+bool ModelTestExpressionTape()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    auto expressionVariable_x = std::make_shared<SHOT::ExpressionVariable>(var_x);
+    auto expressionVariable_y = std::make_shared<SHOT::ExpressionVariable>(var_y);
+    auto expressionVariable_z = std::make_shared<SHOT::ExpressionVariable>(var_z);
+
+    SHOT::NonlinearExpressions terms;
+    terms.add(std::make_shared<SHOT::ExpressionProduct>(expressionVariable_x, expressionVariable_y));
+    terms.add(std::make_shared<SHOT::ExpressionExp>(std::make_shared<SHOT::ExpressionLog>(
+        std::make_shared<SHOT::ExpressionSum>(expressionVariable_z, std::make_shared<SHOT::ExpressionConstant>(1.0)))));
+    terms.add(std::make_shared<SHOT::ExpressionNegate>(
+        std::make_shared<SHOT::ExpressionDivide>(std::make_shared<SHOT::ExpressionSquareRoot>(expressionVariable_x),
+            std::make_shared<SHOT::ExpressionSquare>(expressionVariable_y))));
+    terms.add(std::make_shared<SHOT::ExpressionProduct>(std::make_shared<SHOT::ExpressionSin>(expressionVariable_x),
+        std::make_shared<SHOT::ExpressionCos>(expressionVariable_y)));
+    terms.add(std::make_shared<SHOT::ExpressionPower>(
+        expressionVariable_x, std::make_shared<SHOT::ExpressionConstant>(2.5)));
+    terms.add(std::make_shared<SHOT::ExpressionInvert>(std::make_shared<SHOT::ExpressionArcTan>(expressionVariable_y)));
+    terms.add(std::make_shared<SHOT::ExpressionAbs>(
+        std::make_shared<SHOT::ExpressionProduct>(expressionVariable_z, expressionVariable_x)));
+
+    auto expression = std::make_shared<SHOT::ExpressionSum>(terms);
+
+    SHOT::NonlinearConstraintPtr nonlinearConstraint
+        = std::make_shared<SHOT::NonlinearConstraint>(0, "nlconstr", expression, SHOT_DBL_MIN, 100.0);
+    problem->add(nonlinearConstraint);
+
+    SHOT::LinearTerms objLinearTerms;
+    objLinearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    auto objectiveFunction = std::make_shared<SHOT::LinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, objLinearTerms, 0.0);
+    problem->add(objectiveFunction);
+
+    problem->finalize();
+
+    std::cout << "Nonlinear constraint " << nonlinearConstraint << " created\n";
+
+    if(!nonlinearConstraint->nonlinearExpressionTape.isCompiledFrom(nonlinearConstraint->nonlinearExpression))
+    {
+        std::cout << "The nonlinear expression has not been compiled when finalizing the problem.\n";
+        return (false);
+    }
+
+    std::cout << "The compiled expression contains " << nonlinearConstraint->nonlinearExpressionTape.size()
+              << " instructions.\n";
+
+    std::vector<SHOT::VectorDouble> points = { { 1.0, 2.0, 3.0 }, { 0.5, 0.5, 0.0 }, { 9.0, 4.0, 7.5 } };
+
+    for(auto& P : points)
+    {
+        double treeValue = nonlinearConstraint->nonlinearExpression->calculate(P);
+        double tapeValue = nonlinearConstraint->nonlinearExpressionTape.calculate(P);
+
+        std::cout << "Value in point (" << P[0] << ',' << P[1] << ',' << P[2] << ") is " << tapeValue
+                  << " (should be equal to " << treeValue << ").\n";
+
+        if(std::abs(treeValue - tapeValue) > 1e-12 * std::max(1.0, std::abs(treeValue)))
+            passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestBatchedConstraintValues();
+
+bool ModelTestBatchedConstraintValues()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    SHOT::LinearTerms linearTerms;
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(2.0, var_y));
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(-1.0, var_z));
+
+    auto linearConstraint
+        = std::make_shared<SHOT::LinearConstraint>(0, "linconstr", linearTerms, SHOT_DBL_MIN, 10.0);
+    problem->add(linearConstraint);
+
+    SHOT::QuadraticTerms quadraticTerms;
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(1.0, var_x, var_y));
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(3.0, var_z, var_z));
+
+    auto quadraticConstraint
+        = std::make_shared<SHOT::QuadraticConstraint>(1, "quadconstr", quadraticTerms, SHOT_DBL_MIN, 20.0);
+    problem->add(quadraticConstraint);
+
+    auto expression = std::make_shared<SHOT::ExpressionProduct>(
+        std::make_shared<SHOT::ExpressionExp>(std::make_shared<SHOT::ExpressionVariable>(var_x)),
+        std::make_shared<SHOT::ExpressionVariable>(var_y));
+
+    auto nonlinearConstraint
+        = std::make_shared<SHOT::NonlinearConstraint>(2, "nlconstr", expression, SHOT_DBL_MIN, 30.0);
+    nonlinearConstraint->add(std::make_shared<SHOT::LinearTerm>(-2.0, var_z));
+    nonlinearConstraint->add(std::make_shared<SHOT::MonomialTerm>(0.5, SHOT::Variables{ var_x, var_y, var_z }));
+
+    SHOT::SignomialElements elements = { std::make_shared<SHOT::SignomialElement>(var_x, 1.5),
+        std::make_shared<SHOT::SignomialElement>(var_y, -0.5) };
+    nonlinearConstraint->add(std::make_shared<SHOT::SignomialTerm>(2.0, elements));
+    problem->add(nonlinearConstraint);
+
+    SHOT::LinearTerms objLinearTerms;
+    objLinearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    auto objectiveFunction = std::make_shared<SHOT::LinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, objLinearTerms, 0.0);
+    problem->add(objectiveFunction);
+
+    problem->finalize();
+
+    std::vector<SHOT::VectorDouble> points
+        = { { 1.0, 2.0, 3.0 }, { 0.5, 0.5, 0.0 }, { 9.0, 4.0, 7.5 }, { 2.5, 1.0, 0.25 } };
+
+    auto block = problem->getPointBlock(points);
+    auto values = problem->calculateConstraintFunctionValues(block, points.size(), problem->numericConstraints);
+
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        for(size_t j = 0; j < problem->numericConstraints.size(); j++)
+        {
+            double value = problem->numericConstraints[j]->calculateFunctionValue(points[i]);
+            double batchedValue = values[j * points.size() + i];
+
+            std::cout << "Value of constraint " << problem->numericConstraints[j]->name << " in point " << i
+                      << " is " << batchedValue << " (should be equal to " << value << ").\n";
+
+            if(std::abs(value - batchedValue) > 1e-12 * std::max(1.0, std::abs(value)))
+                passed = false;
+        }
+    }
+
+    auto maxValues = problem->getMaxNumericConstraintValues(points, problem->nonlinearConstraints);
+
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        auto maxValue = problem->getMaxNumericConstraintValue(points[i], problem->nonlinearConstraints);
+
+        std::cout << "Maximal nonlinear constraint value in point " << i << " is " << maxValues[i].normalizedValue
+                  << " (should be equal to " << maxValue.normalizedValue << ").\n";
+
+        if(std::abs(maxValue.normalizedValue - maxValues[i].normalizedValue)
+            > 1e-12 * std::max(1.0, std::abs(maxValue.normalizedValue)))
+            passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestSparseGradient();
+
+bool ModelTestSparseGradient()
+{
+    bool passed = true;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::LinearTerms linearTerms;
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(2.0, var_z));
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    linearTerms.add(std::make_shared<SHOT::LinearTerm>(3.0, var_z));
+
+    SHOT::QuadraticTerms quadraticTerms;
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(1.0, var_y, var_y));
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(4.0, var_z, var_x));
+
+    SHOT::VectorDouble point = { 1.0, 2.0, 3.0 };
+
+    auto gradient = SHOT::Utilities::combineSparseVariableVectors(
+        linearTerms.calculateGradient(point), quadraticTerms.calculateGradient(point));
+
+    // d/dx = 1 + 4z, d/dy = 2y, d/dz = 5 + 4x
+    std::vector<double> expected = { 13.0, 4.0, 9.0 };
+
+    if(gradient.size() != expected.size())
+    {
+        std::cout << "The gradient has " << gradient.size() << " elements (should be " << expected.size() << ").\n";
+        return (false);
+    }
+
+    int previousIndex = -1;
+
+    for(auto& G : gradient)
+    {
+        std::cout << "Gradient for variable " << G.first->name << " is " << G.second << " (should be "
+                  << expected[G.first->index] << ").\n";
+
+        if(G.first->index <= previousIndex)
+        {
+            std::cout << "The gradient elements are not sorted on the variable indices.\n";
+            passed = false;
+        }
+
+        if(G.second != expected[G.first->index])
+            passed = false;
+
+        previousIndex = G.first->index;
+    }
+
+    if(gradient.find(var_y) == gradient.end() || gradient.find(var_y)->second != 4.0)
+        passed = false;
+
+    gradient.clear();
+
+    if(!gradient.empty() || gradient.capacity() < expected.size())
+    {
+        std::cout << "The storage of the gradient was not kept when cleared.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestBatchedConstraintGradients();
+
+bool ModelTestBatchedConstraintGradients()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    auto expressionVariable_x = std::make_shared<SHOT::ExpressionVariable>(var_x);
+    auto expressionVariable_y = std::make_shared<SHOT::ExpressionVariable>(var_y);
+    auto expressionVariable_z = std::make_shared<SHOT::ExpressionVariable>(var_z);
+
+    auto firstConstraint = std::make_shared<SHOT::NonlinearConstraint>(0, "nlconstr1",
+        std::make_shared<SHOT::ExpressionProduct>(
+            std::make_shared<SHOT::ExpressionExp>(expressionVariable_x), expressionVariable_y),
+        SHOT_DBL_MIN, 30.0);
+    firstConstraint->add(std::make_shared<SHOT::LinearTerm>(-2.0, var_z));
+    problem->add(firstConstraint);
+
+    auto secondConstraint = std::make_shared<SHOT::NonlinearConstraint>(1, "nlconstr2",
+        std::make_shared<SHOT::ExpressionSquare>(expressionVariable_z), SHOT_DBL_MIN, 10.0);
+    secondConstraint->add(std::make_shared<SHOT::QuadraticTerm>(1.0, var_x, var_y));
+    problem->add(secondConstraint);
+
+    auto thirdConstraint = std::make_shared<SHOT::NonlinearConstraint>(2, "nlconstr3",
+        std::make_shared<SHOT::ExpressionLog>(expressionVariable_y), SHOT_DBL_MIN, 5.0);
+    thirdConstraint->add(std::make_shared<SHOT::LinearTerm>(1.0, var_y));
+    problem->add(thirdConstraint);
+
+    SHOT::LinearTerms objLinearTerms;
+    objLinearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    auto objectiveFunction = std::make_shared<SHOT::LinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, objLinearTerms, 0.0);
+    problem->add(objectiveFunction);
+
+    problem->finalize();
+
+    std::vector<SHOT::VectorDouble> points = { { 1.0, 2.0, 3.0 }, { 0.5, 0.5, 0.0 }, { 9.0, 4.0, 7.5 } };
+
+    // Selecting a subset of the constraints in a different order than in the problem
+    SHOT::NumericConstraints constraints = { thirdConstraint, firstConstraint };
+
+    for(auto& P : points)
+    {
+        auto gradients = problem->calculateConstraintGradients(P, constraints, false);
+
+        for(size_t i = 0; i < constraints.size(); i++)
+        {
+            auto gradient = constraints[i]->calculateGradient(P, false);
+
+            if(gradients[i].size() != gradient.size())
+            {
+                std::cout << "The gradient of constraint " << constraints[i]->name << " has " << gradients[i].size()
+                          << " elements (should be " << gradient.size() << ").\n";
+                passed = false;
+                continue;
+            }
+
+            for(auto& G : gradient)
+            {
+                auto element = gradients[i].find(G.first);
+
+                if(element == gradients[i].end())
+                {
+                    std::cout << "The gradient of constraint " << constraints[i]->name << " for variable "
+                              << G.first->name << " is missing.\n";
+                    passed = false;
+                    continue;
+                }
+
+                double batchedValue = element->second;
+
+                std::cout << "Gradient of constraint " << constraints[i]->name << " for variable " << G.first->name
+                          << " is " << batchedValue << " (should be equal to " << G.second << ").\n";
+
+                if(std::abs(G.second - batchedValue) > 1e-12 * std::max(1.0, std::abs(G.second)))
+                    passed = false;
+            }
+        }
+    }
+
+    return passed;
+}
+
+bool ModelTestLagrangianHessian();
+
+bool ModelTestLagrangianHessian()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    auto expressionVariable_x = std::make_shared<SHOT::ExpressionVariable>(var_x);
+    auto expressionVariable_y = std::make_shared<SHOT::ExpressionVariable>(var_y);
+    auto expressionVariable_z = std::make_shared<SHOT::ExpressionVariable>(var_z);
+
+    SHOT::QuadraticTerms quadraticTerms;
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(1.0, var_x, var_z));
+    quadraticTerms.add(std::make_shared<SHOT::QuadraticTerm>(3.0, var_y, var_y));
+
+    auto quadraticConstraint
+        = std::make_shared<SHOT::QuadraticConstraint>(0, "quadconstr", quadraticTerms, SHOT_DBL_MIN, 20.0);
+    problem->add(quadraticConstraint);
+
+    auto firstConstraint = std::make_shared<SHOT::NonlinearConstraint>(1, "nlconstr1",
+        std::make_shared<SHOT::ExpressionProduct>(
+            std::make_shared<SHOT::ExpressionExp>(expressionVariable_x), expressionVariable_y),
+        SHOT_DBL_MIN, 30.0);
+    firstConstraint->add(std::make_shared<SHOT::MonomialTerm>(0.5, SHOT::Variables{ var_x, var_y, var_z }));
+    problem->add(firstConstraint);
+
+    auto secondConstraint = std::make_shared<SHOT::NonlinearConstraint>(2, "nlconstr2",
+        std::make_shared<SHOT::ExpressionLog>(expressionVariable_y), SHOT_DBL_MIN, 5.0);
+    secondConstraint->add(std::make_shared<SHOT::QuadraticTerm>(2.0, var_z, var_z));
+    problem->add(secondConstraint);
+
+    auto objectiveFunction = std::make_shared<SHOT::NonlinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize,
+        std::make_shared<SHOT::ExpressionSquare>(
+            std::make_shared<SHOT::ExpressionSum>(expressionVariable_x, expressionVariable_z)),
+        0.0);
+    problem->add(objectiveFunction);
+
+    problem->finalize();
+
+    auto pattern = problem->getLagrangianHessianSparsityPattern();
+
+    SHOT::VectorDouble point = { 1.0, 2.0, 3.0 };
+    SHOT::VectorDouble multipliers = { 0.5, 2.0, -1.5 };
+    double objectiveFactor = 0.75;
+
+    SHOT::VectorDouble values(pattern->size());
+    problem->calculateLagrangianHessian(point, objectiveFactor, &multipliers[0], &values[0]);
+
+    // The Hessian of the Lagrangian calculated from the Hessians of the individual functions
+    SHOT::SparseVariableMatrix expected;
+
+    for(auto& E : objectiveFunction->calculateHessian(point, false))
+        expected.add(E.first, objectiveFactor * E.second);
+
+    for(auto& C : problem->numericConstraints)
+    {
+        for(auto& E : C->calculateHessian(point, false))
+            expected.add(E.first, multipliers[C->index] * E.second);
+    }
+
+    for(size_t i = 0; i < pattern->size(); i++)
+    {
+        auto element = expected.find(pattern->at(i));
+        double expectedValue = (element == expected.end()) ? 0.0 : element->second;
+
+        std::cout << "Hessian of the Lagrangian for (" << pattern->at(i).first->name << ','
+                  << pattern->at(i).second->name << ") is " << values[i] << " (should be equal to " << expectedValue
+                  << ").\n";
+
+        if(std::abs(values[i] - expectedValue) > 1e-12 * std::max(1.0, std::abs(expectedValue)))
+            passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestExpressionArena();
+
+bool ModelTestExpressionArena()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    if(problem->expressionArena != SHOT::ExpressionArena::getCurrent())
+    {
+        std::cout << "The problem does not own the current expression arena.\n";
+        passed = false;
+    }
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y };
+    problem->add(variables);
+
+    auto expressionVariable_x = SHOT::makeExpression<SHOT::ExpressionVariable>(var_x);
+    auto expressionVariable_y = SHOT::makeExpression<SHOT::ExpressionVariable>(var_y);
+
+    int numberOfTerms = 10000;
+    SHOT::NonlinearExpressions terms;
+
+    for(int i = 0; i < numberOfTerms; i++)
+    {
+        terms.add(SHOT::makeExpression<SHOT::ExpressionProduct>(SHOT::makeExpression<SHOT::ExpressionConstant>(i + 1.0),
+            SHOT::makeExpression<SHOT::ExpressionProduct>(expressionVariable_x, expressionVariable_y)));
+    }
+
+    auto constraint = std::make_shared<SHOT::NonlinearConstraint>(
+        0, "nlconstr", SHOT::makeExpression<SHOT::ExpressionSum>(terms), SHOT_DBL_MIN, 0.0);
+    problem->add(constraint);
+
+    SHOT::LinearTerms objLinearTerms;
+    objLinearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    problem->add(std::make_shared<SHOT::LinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, objLinearTerms, 0.0));
+
+    problem->finalize();
+
+    SHOT::VectorDouble point = { 2.0, 3.0 };
+    double value = constraint->calculateFunctionValue(point);
+    double expectedValue = 6.0 * numberOfTerms * (numberOfTerms + 1) / 2.0;
+
+    std::cout << "Constraint value is " << value << " (should be equal to " << expectedValue << ").\n";
+
+    if(std::abs(value - expectedValue) > 1e-10 * expectedValue)
+        passed = false;
+
+    auto arena = problem->expressionArena;
+
+    std::cout << "The expressions use " << arena->getAllocatedSize() << " bytes in " << arena->getNumberOfBlocks()
+              << " blocks.\n";
+
+    // The nodes should be allocated in a small number of large blocks
+    if(arena->getNumberOfBlocks() > 20)
+        passed = false;
+
+    // The arena is released with the last node allocated in it
+    std::weak_ptr<SHOT::ExpressionArena> firstArena = arena;
+    arena.reset();
+    terms.clear();
+    expressionVariable_x.reset();
+    expressionVariable_y.reset();
+    constraint.reset();
+    env->problem.reset();
+    problem = std::make_shared<SHOT::Problem>(env);
+
+    if(!firstArena.expired())
+    {
+        std::cout << "The expression arena was not released with the problem.\n";
+        passed = false;
+    }
+
+    return passed;
+}
+
+bool ModelTestCommonSubexpressions();
+
+bool ModelTestCommonSubexpressions()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.0, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y };
+    problem->add(variables);
+
+    // Creates exp(2*x) and log(1+y) with new nodes each time
+    auto createExp = [&]() {
+        return (SHOT::makeExpression<SHOT::ExpressionExp>(
+            SHOT::makeExpression<SHOT::ExpressionProduct>(SHOT::makeExpression<SHOT::ExpressionConstant>(2.0),
+                SHOT::makeExpression<SHOT::ExpressionVariable>(var_x))));
+    };
+
+    auto createLog = [&]() {
+        return (SHOT::makeExpression<SHOT::ExpressionLog>(
+            SHOT::makeExpression<SHOT::ExpressionSum>(SHOT::makeExpression<SHOT::ExpressionConstant>(1.0),
+                SHOT::makeExpression<SHOT::ExpressionVariable>(var_y))));
+    };
+
+    auto firstConstraint = std::make_shared<SHOT::NonlinearConstraint>(
+        0, "nlconstr1", SHOT::makeExpression<SHOT::ExpressionSum>(createExp(), createLog()), SHOT_DBL_MIN, 10.0);
+    problem->add(firstConstraint);
+
+    auto secondConstraint = std::make_shared<SHOT::NonlinearConstraint>(1, "nlconstr2",
+        SHOT::makeExpression<SHOT::ExpressionProduct>(createExp(), createLog()), SHOT_DBL_MIN, 10.0);
+    problem->add(secondConstraint);
+
+    auto objectiveFunction = std::make_shared<SHOT::NonlinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, createLog(), 0.0);
+    problem->add(objectiveFunction);
+
+    problem->finalize();
+
+    // The product 2*x, the sum 1+y, exp and log in the second constraint, and the sum and log in the objective
+    std::cout << "Number of eliminated nodes is " << problem->properties.numberOfEliminatedExpressionNodes
+              << " (should be 6).\n";
+
+    if(problem->properties.numberOfEliminatedExpressionNodes != 6)
+        passed = false;
+
+    auto firstSum = std::dynamic_pointer_cast<SHOT::ExpressionSum>(firstConstraint->nonlinearExpression);
+    auto secondProduct = std::dynamic_pointer_cast<SHOT::ExpressionProduct>(secondConstraint->nonlinearExpression);
+
+    if(firstSum->children[0] != secondProduct->children[0] || firstSum->children[1] != secondProduct->children[1]
+        || firstSum->children[1] != objectiveFunction->nonlinearExpression)
+    {
+        std::cout << "The identical subexpressions are not shared.\n";
+        passed = false;
+    }
+
+    SHOT::VectorDouble point = { 0.5, 2.0 };
+
+    double expValue = std::exp(1.0);
+    double logValue = std::log(3.0);
+
+    SHOT::NumericConstraints constraints = { firstConstraint, secondConstraint };
+    auto gradients = problem->calculateConstraintGradients(point, constraints, false);
+
+    SHOT::VectorDouble values = { firstConstraint->calculateFunctionValue(point),
+        secondConstraint->calculateFunctionValue(point), objectiveFunction->calculateValue(point) };
+    SHOT::VectorDouble expectedValues = { expValue + logValue, expValue * logValue, logValue };
+
+    std::vector<SHOT::VectorDouble> expectedGradients
+        = { { 2.0 * expValue, 1.0 / 3.0 }, { 2.0 * expValue * logValue, expValue / 3.0 } };
+
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        std::cout << "Function value " << i << " is " << values[i] << " (should be equal to " << expectedValues[i]
+                  << ").\n";
+
+        if(std::abs(values[i] - expectedValues[i]) > 1e-12)
+            passed = false;
+    }
+
+    for(size_t i = 0; i < gradients.size(); i++)
+    {
+        for(auto& V : variables)
+        {
+            auto element = gradients[i].find(V);
+            double value = (element == gradients[i].end()) ? 0.0 : element->second;
+
+            std::cout << "Gradient of constraint " << i << " for " << V->name << " is " << value
+                      << " (should be equal to " << expectedGradients[i][V->index] << ").\n";
+
+            if(std::abs(value - expectedGradients[i][V->index]) > 1e-12)
+                passed = false;
+        }
+    }
+
+    return passed;
+}
+
+bool ModelTestDirectionalDerivative();
+
+bool ModelTestDirectionalDerivative()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+    SHOT::ProblemPtr problem = std::make_shared<SHOT::Problem>(env);
+    env->problem = problem;
+
+    auto var_x = std::make_shared<SHOT::Variable>("x", 0, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_y = std::make_shared<SHOT::Variable>("y", 1, SHOT::E_VariableType::Real, 0.5, 10.0);
+    auto var_z = std::make_shared<SHOT::Variable>("z", 2, SHOT::E_VariableType::Real, 0.0, 10.0);
+
+    SHOT::Variables variables = { var_x, var_y, var_z };
+    problem->add(variables);
+
+    auto expressionVariable_x = std::make_shared<SHOT::ExpressionVariable>(var_x);
+    auto expressionVariable_y = std::make_shared<SHOT::ExpressionVariable>(var_y);
+    auto expressionVariable_z = std::make_shared<SHOT::ExpressionVariable>(var_z);
+
+    SHOT::NonlinearExpressions terms;
+    terms.add(std::make_shared<SHOT::ExpressionProduct>(expressionVariable_x, expressionVariable_y));
+    terms.add(std::make_shared<SHOT::ExpressionExp>(std::make_shared<SHOT::ExpressionLog>(
+        std::make_shared<SHOT::ExpressionSum>(expressionVariable_z, std::make_shared<SHOT::ExpressionConstant>(1.0)))));
+    terms.add(std::make_shared<SHOT::ExpressionNegate>(
+        std::make_shared<SHOT::ExpressionDivide>(std::make_shared<SHOT::ExpressionSquareRoot>(expressionVariable_x),
+            std::make_shared<SHOT::ExpressionSquare>(expressionVariable_y))));
+    terms.add(std::make_shared<SHOT::ExpressionProduct>(std::make_shared<SHOT::ExpressionSin>(expressionVariable_x),
+        std::make_shared<SHOT::ExpressionCos>(expressionVariable_y)));
+    terms.add(std::make_shared<SHOT::ExpressionPower>(
+        expressionVariable_x, std::make_shared<SHOT::ExpressionConstant>(2.5)));
+    terms.add(std::make_shared<SHOT::ExpressionInvert>(std::make_shared<SHOT::ExpressionArcTan>(expressionVariable_y)));
+
+    SHOT::NonlinearConstraintPtr nonlinearConstraint = std::make_shared<SHOT::NonlinearConstraint>(
+        0, "nlconstr", std::make_shared<SHOT::ExpressionSum>(terms), SHOT_DBL_MIN, 100.0);
+    nonlinearConstraint->add(std::make_shared<SHOT::LinearTerm>(-2.0, var_z));
+    nonlinearConstraint->add(std::make_shared<SHOT::QuadraticTerm>(1.5, var_x, var_z));
+    nonlinearConstraint->add(std::make_shared<SHOT::MonomialTerm>(0.5, SHOT::Variables{ var_x, var_y, var_z }));
+    problem->add(nonlinearConstraint);
+
+    SHOT::LinearTerms objLinearTerms;
+    objLinearTerms.add(std::make_shared<SHOT::LinearTerm>(1.0, var_x));
+    auto objectiveFunction = std::make_shared<SHOT::LinearObjectiveFunction>(
+        SHOT::E_ObjectiveFunctionDirection::Minimize, objLinearTerms, 0.0);
+    problem->add(objectiveFunction);
+
+    problem->finalize();
+
+    std::vector<SHOT::VectorDouble> points = { { 1.0, 2.0, 3.0 }, { 0.5, 0.5, 0.0 }, { 9.0, 4.0, 7.5 } };
+    SHOT::VectorDouble direction = { 0.5, -1.0, 2.0 };
+
+    for(auto& P : points)
+    {
+        double directionalDerivative;
+        double value = nonlinearConstraint->calculateFunctionValue(P, direction, directionalDerivative);
+
+        // The derivative along the direction is the gradient times the direction
+        double expectedDerivative = 0.0;
+
+        for(auto& G : nonlinearConstraint->calculateGradient(P, false))
+            expectedDerivative += G.second * direction[G.first->index];
+
+        double expectedValue = nonlinearConstraint->calculateFunctionValue(P);
+
+        std::cout << "Derivative in point (" << P[0] << ',' << P[1] << ',' << P[2] << ") is " << directionalDerivative
+                  << " (should be equal to " << expectedDerivative << ").\n";
+
+        if(std::abs(value - expectedValue) > 1e-12 * std::max(1.0, std::abs(expectedValue)))
+            passed = false;
+
+        if(std::abs(directionalDerivative - expectedDerivative) > 1e-10 * std::max(1.0, std::abs(expectedDerivative)))
+            passed = false;
+    }
+
+    return passed;
+}
 
 bool TestReadProblem(const std::string& problemFile);
 bool TestRootsearch(const std::string& problemFile);
@@ -83,6 +769,30 @@ int ModelTest(int argc, char* argv[])
     case 9:
         passed = ModelTestConvexity();
         break;
+    case 10:
+        passed = ModelTestExpressionTape();
+        break;
+    case 11:
+        passed = ModelTestBatchedConstraintValues();
+        break;
+    case 12:
+        passed = ModelTestSparseGradient();
+        break;
+    case 13:
+        passed = ModelTestBatchedConstraintGradients();
+        break;
+    case 14:
+        passed = ModelTestLagrangianHessian();
+        break;
+    case 15:
+        passed = ModelTestExpressionArena();
+        break;
+    case 16:
+        passed = ModelTestCommonSubexpressions();
+        break;
+    case 17:
+        passed = ModelTestDirectionalDerivative();
+        break;
     default:
         passed = false;
         std::cout << "Test #" << choice << " does not exist!\n";
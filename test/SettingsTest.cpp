@@ -27,6 +27,7 @@ namespace fs = std::experimental;
 using namespace SHOT;
 
 bool SettingsTestOptions(bool useOSiL);
+bool SettingsTestSettingRef();
 
 int SettingsTest(int argc, char* argv[])
 {
@@ -57,6 +58,11 @@ int SettingsTest(int argc, char* argv[])
         passed = SettingsTestOptions(false);
         std::cout << "Finished test to read and write opt files." << std::endl;
         break;
+    case 3:
+        std::cout << "Starting test of setting handles:" << std::endl;
+        passed = SettingsTestSettingRef();
+        std::cout << "Finished test of setting handles." << std::endl;
+        break;
     default:
         passed = false;
         std::cout << "Test #" << choice << " does not exist!\n";
@@ -120,4 +126,50 @@ bool SettingsTestOptions(bool useOSiL)
     }
 
     return passed;
-}
\ No newline at end of file
+}
+
+// Test that setting handles give the same values as getSetting, also after the settings have been updated
+bool SettingsTestSettingRef()
+{
+    bool passed = true;
+
+    std::unique_ptr<Solver> solver = std::make_unique<Solver>();
+    auto env = solver->getEnvironment();
+
+    auto maxPerIteration = env->settings->getSettingRef<int>("HyperplaneCuts.MaxPerIteration", "Dual");
+    auto selectionFactor = env->settings->getSettingRef<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual");
+    auto debugPath = env->settings->getSettingRef<std::string>("Debug.Path", "Output");
+
+    if(maxPerIteration.get() != env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual")
+        || selectionFactor.get()
+            != env->settings->getSetting<double>("HyperplaneCuts.ConstraintSelectionFactor", "Dual")
+        || debugPath.get() != env->settings->getSetting<std::string>("Debug.Path", "Output"))
+    {
+        std::cout << "The handles do not give the default values of the settings." << std::endl;
+        passed = false;
+    }
+
+    env->settings->updateSetting("HyperplaneCuts.MaxPerIteration", "Dual", maxPerIteration.get() + 7);
+    env->settings->updateSetting("HyperplaneCuts.ConstraintSelectionFactor", "Dual", 0.25);
+    env->settings->updateSetting("Debug.Path", "Output", std::string("debugpath"));
+
+    if(maxPerIteration.get() != env->settings->getSetting<int>("HyperplaneCuts.MaxPerIteration", "Dual")
+        || selectionFactor.get() != 0.25 || debugPath.get() != "debugpath")
+    {
+        std::cout << "The handles do not give the updated values of the settings." << std::endl;
+        passed = false;
+    }
+
+    try
+    {
+        env->settings->getSettingRef<int>("NonexistingSetting", "Dual");
+
+        std::cout << "A handle to a nonexisting setting could be created." << std::endl;
+        passed = false;
+    }
+    catch(SettingKeyNotFoundException&)
+    {
+    }
+
+    return passed;
+}